@@ -0,0 +1,121 @@
+#include <benchmark/benchmark.h>
+
+#include <vector>
+
+#include "s21_matrix_batch.h"
+
+namespace {
+
+constexpr size_t kCount = 4096;
+
+// diagonally dominant, so every matrix is invertible
+S21Matrix<double> MakeMatrix(size_t n, unsigned seed) {
+  S21Matrix<double> mtx(n, n);
+  for (size_t r = 0; r < n; ++r) {
+    for (size_t c = 0; c < n; ++c) {
+      seed = seed * 1103515245u + 12345u;
+      mtx(r, c) = static_cast<double>((seed >> 8) % 19) - 9.0;
+    }
+    mtx(r, r) += 10.0 * n;
+  }
+  return mtx;
+}
+
+std::vector<S21Matrix<double>> MakeMatrices(size_t n) {
+  std::vector<S21Matrix<double>> matrices;
+  for (size_t i = 0; i < kCount; ++i) matrices.push_back(MakeMatrix(n, i));
+  return matrices;
+}
+
+template <typename Batch>
+Batch MakeBatch(size_t n) {
+  Batch batch(kCount, n, n);
+  for (size_t i = 0; i < kCount; ++i) batch.Set(i, MakeMatrix(n, i));
+  return batch;
+}
+
+void SetMatrices(benchmark::State& state) {
+  state.SetItemsProcessed(state.iterations() * kCount);
+}
+
+// the baseline: one S21Matrix call per matrix
+
+void BM_LoopMulMatrix(benchmark::State& state) {
+  auto matrices = MakeMatrices(state.range(0));
+  for (auto _ : state) {
+    for (size_t i = 0; i < kCount; ++i) {
+      benchmark::DoNotOptimize(matrices[i] * matrices[kCount - 1 - i]);
+    }
+  }
+  SetMatrices(state);
+}
+
+void BM_LoopDeterminant(benchmark::State& state) {
+  auto matrices = MakeMatrices(state.range(0));
+  for (auto _ : state) {
+    for (const auto& mtx : matrices) {
+      benchmark::DoNotOptimize(mtx.Determinant());
+    }
+  }
+  SetMatrices(state);
+}
+
+void BM_LoopInverseMatrix(benchmark::State& state) {
+  auto matrices = MakeMatrices(state.range(0));
+  for (auto _ : state) {
+    for (const auto& mtx : matrices) {
+      benchmark::DoNotOptimize(mtx.InverseMatrix());
+    }
+  }
+  SetMatrices(state);
+}
+
+// the same work on a batch
+
+template <s21::BatchLayout L>
+void BM_BatchMulMatrix(benchmark::State& state) {
+  auto batch = MakeBatch<S21MatrixBatch<double, L>>(state.range(0));
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(batch * batch);
+  }
+  SetMatrices(state);
+}
+
+template <s21::BatchLayout L>
+void BM_BatchDeterminant(benchmark::State& state) {
+  auto batch = MakeBatch<S21MatrixBatch<double, L>>(state.range(0));
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(batch.Determinant());
+  }
+  SetMatrices(state);
+}
+
+template <s21::BatchLayout L>
+void BM_BatchInverseMatrix(benchmark::State& state) {
+  auto batch = MakeBatch<S21MatrixBatch<double, L>>(state.range(0));
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(batch.InverseMatrix());
+  }
+  SetMatrices(state);
+}
+
+}  // namespace
+
+#define S21_BATCH_BENCHMARK(name) \
+  name->Arg(3)->Arg(4)->Unit(benchmark::kMicrosecond)
+
+S21_BATCH_BENCHMARK(BENCHMARK(BM_LoopMulMatrix));
+S21_BATCH_BENCHMARK(BENCHMARK(BM_LoopDeterminant));
+S21_BATCH_BENCHMARK(BENCHMARK(BM_LoopInverseMatrix));
+S21_BATCH_BENCHMARK(
+    BENCHMARK_TEMPLATE(BM_BatchMulMatrix, s21::BatchLayout::kAos));
+S21_BATCH_BENCHMARK(
+    BENCHMARK_TEMPLATE(BM_BatchMulMatrix, s21::BatchLayout::kSoa));
+S21_BATCH_BENCHMARK(
+    BENCHMARK_TEMPLATE(BM_BatchDeterminant, s21::BatchLayout::kAos));
+S21_BATCH_BENCHMARK(
+    BENCHMARK_TEMPLATE(BM_BatchDeterminant, s21::BatchLayout::kSoa));
+S21_BATCH_BENCHMARK(
+    BENCHMARK_TEMPLATE(BM_BatchInverseMatrix, s21::BatchLayout::kAos));
+S21_BATCH_BENCHMARK(
+    BENCHMARK_TEMPLATE(BM_BatchInverseMatrix, s21::BatchLayout::kSoa));
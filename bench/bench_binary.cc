@@ -0,0 +1,106 @@
+#include <benchmark/benchmark.h>
+
+#include <filesystem>
+#include <fstream>
+#include <string>
+
+#include "s21_matrix_binary.h"
+
+namespace {
+
+S21Matrix<double> MakeRandom(size_t rows, size_t cols) {
+  S21Matrix<double> mtx(rows, cols);
+  unsigned seed = 2024;
+  for (size_t r = 0; r < rows; ++r) {
+    for (size_t c = 0; c < cols; ++c) {
+      seed = seed * 1103515245u + 12345u;
+      mtx(r, c) = static_cast<double>(seed >> 8) / 3.0;
+    }
+  }
+  return mtx;
+}
+
+std::string TempPath(const char* name) {
+  return (std::filesystem::temp_directory_path() / name).string();
+}
+
+// throughput in bytes of matrix elements, whatever the file size
+void SetThroughput(benchmark::State& state, size_t n) {
+  state.counters["Throughput"] = benchmark::Counter(
+      static_cast<double>(n * n * sizeof(double)),
+      benchmark::Counter::kIsIterationInvariantRate,
+      benchmark::Counter::kIs1024);
+}
+
+// the text path: operator<<, i.e. Repr() with std::to_string per element
+void BM_SaveText(benchmark::State& state) {
+  size_t n = state.range(0);
+  auto mtx = MakeRandom(n, n);
+  std::string path = TempPath("s21_bench_text.txt");
+  for (auto _ : state) {
+    std::ofstream file(path);
+    file << mtx;
+  }
+  std::filesystem::remove(path);
+  SetThroughput(state, n);
+}
+
+void BM_SaveBinary(benchmark::State& state) {
+  size_t n = state.range(0);
+  auto mtx = MakeRandom(n, n);
+  std::string path = TempPath("s21_bench_save.bin");
+  for (auto _ : state) {
+    s21::SaveBinary(path, mtx);
+  }
+  std::filesystem::remove(path);
+  SetThroughput(state, n);
+}
+
+void BM_LoadBinary(benchmark::State& state) {
+  size_t n = state.range(0);
+  std::string path = TempPath("s21_bench_load.bin");
+  s21::SaveBinary(path, MakeRandom(n, n));
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(s21::LoadBinary<double>(path));
+  }
+  std::filesystem::remove(path);
+  SetThroughput(state, n);
+}
+
+// mapping alone is O(1); reading every element faults the pages in
+void BM_MapBinary(benchmark::State& state) {
+  size_t n = state.range(0);
+  std::string path = TempPath("s21_bench_map.bin");
+  s21::SaveBinary(path, MakeRandom(n, n));
+  for (auto _ : state) {
+    s21::MappedMatrix<double> mapped(path);
+    auto view = mapped.View();
+    double sum = 0.0;
+    for (size_t r = 0; r < n; ++r) {
+      const double* row = view.RowData(r);
+      for (size_t c = 0; c < n; ++c) sum += row[c];
+    }
+    benchmark::DoNotOptimize(sum);
+  }
+  std::filesystem::remove(path);
+  SetThroughput(state, n);
+}
+
+}  // namespace
+
+BENCHMARK(BM_SaveText)->Arg(256)->Arg(1024)->Unit(benchmark::kMillisecond);
+BENCHMARK(BM_SaveBinary)
+    ->Arg(256)
+    ->Arg(1024)
+    ->Arg(4096)
+    ->Unit(benchmark::kMillisecond);
+BENCHMARK(BM_LoadBinary)
+    ->Arg(256)
+    ->Arg(1024)
+    ->Arg(4096)
+    ->Unit(benchmark::kMillisecond);
+BENCHMARK(BM_MapBinary)
+    ->Arg(256)
+    ->Arg(1024)
+    ->Arg(4096)
+    ->Unit(benchmark::kMillisecond);
@@ -0,0 +1,74 @@
+#include <benchmark/benchmark.h>
+
+#include "s21_matrix_oop.h"
+
+namespace {
+
+// `a + b - c * 2.0` the way the eager operators computed it:
+// a copy per operator and a sweep over memory per step.
+void BM_ChainEager(benchmark::State& state) {
+  size_t n = state.range(0);
+  S21Matrix<double> a(n, n, 1.0), b(n, n, 2.0), c(n, n, 3.0);
+  for (auto _ : state) {
+    S21Matrix<double> sum(a);
+    sum.SumMatrix(b);
+    S21Matrix<double> scaled(c);
+    scaled.MulNumber(2.0);
+    S21Matrix<double> res(sum);
+    res.SubMatrix(scaled);
+    benchmark::DoNotOptimize(res);
+  }
+  state.SetBytesProcessed(state.iterations() * 4 * n * n * sizeof(double));
+}
+
+void BM_ChainFused(benchmark::State& state) {
+  size_t n = state.range(0);
+  S21Matrix<double> a(n, n, 1.0), b(n, n, 2.0), c(n, n, 3.0);
+  for (auto _ : state) {
+    S21Matrix<double> res = a + b - c * 2.0;
+    benchmark::DoNotOptimize(res);
+  }
+  state.SetBytesProcessed(state.iterations() * 4 * n * n * sizeof(double));
+}
+
+void BM_ChainFusedInPlace(benchmark::State& state) {
+  size_t n = state.range(0);
+  S21Matrix<double> a(n, n, 1.0), b(n, n, 2.0), c(n, n, 3.0);
+  S21Matrix<double> res(n, n);
+  for (auto _ : state) {
+    res = a + b - c * 2.0;
+    benchmark::DoNotOptimize(res);
+  }
+  state.SetBytesProcessed(state.iterations() * 4 * n * n * sizeof(double));
+}
+
+// `(a * b) * c + a` with the intermediate results kept in named
+// matrices: every step allocates a result of its own
+void BM_ProductChainNamed(benchmark::State& state) {
+  size_t n = state.range(0);
+  S21Matrix<double> a(n, n, 1.0), b(n, n, 2.0), c(n, n, 3.0);
+  for (auto _ : state) {
+    S21Matrix<double> ab = a * b;
+    S21Matrix<double> abc = ab * c;
+    S21Matrix<double> res = abc + a;
+    benchmark::DoNotOptimize(res);
+  }
+}
+
+// the same chain of temporaries, each step reusing the dying one
+void BM_ProductChainTemporary(benchmark::State& state) {
+  size_t n = state.range(0);
+  S21Matrix<double> a(n, n, 1.0), b(n, n, 2.0), c(n, n, 3.0);
+  for (auto _ : state) {
+    S21Matrix<double> res = (a * b) * c + a;
+    benchmark::DoNotOptimize(res);
+  }
+}
+
+}  // namespace
+
+BENCHMARK(BM_ChainEager)->RangeMultiplier(4)->Range(16, 4096);
+BENCHMARK(BM_ChainFused)->RangeMultiplier(4)->Range(16, 4096);
+BENCHMARK(BM_ChainFusedInPlace)->RangeMultiplier(4)->Range(16, 4096);
+BENCHMARK(BM_ProductChainNamed)->RangeMultiplier(4)->Range(16, 1024);
+BENCHMARK(BM_ProductChainTemporary)->RangeMultiplier(4)->Range(16, 1024);
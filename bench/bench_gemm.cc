@@ -0,0 +1,95 @@
+#include <benchmark/benchmark.h>
+
+#include "s21_matrix_oop.h"
+
+namespace {
+
+template <typename T>
+S21Matrix<T> MakeRandom(size_t rows, size_t cols) {
+  S21Matrix<T> mtx(rows, cols);
+  unsigned seed = 12345;
+  for (size_t r = 0; r < rows; ++r) {
+    for (size_t c = 0; c < cols; ++c) {
+      seed = seed * 1103515245u + 12345u;
+      mtx(r, c) = static_cast<T>((seed >> 16) % 1000) / T(1000);
+    }
+  }
+  return mtx;
+}
+
+// The triple loop MulMatrix used before the packed kernel.
+template <typename T>
+S21Matrix<T> NaiveMul(const S21Matrix<T>& lhs, const S21Matrix<T>& rhs) {
+  S21Matrix<T> res(lhs.GetRows(), rhs.GetCols());
+  for (size_t r = 0; r < lhs.GetRows(); ++r) {
+    for (size_t m = 0; m < lhs.GetCols(); ++m) {
+      for (size_t c = 0; c < rhs.GetCols(); ++c) {
+        res(r, c) += lhs(r, m) * rhs(m, c);
+      }
+    }
+  }
+  return res;
+}
+
+void SetFlops(benchmark::State& state, size_t n) {
+  state.counters["FLOPS"] = benchmark::Counter(
+      2.0 * n * n * n, benchmark::Counter::kIsIterationInvariantRate,
+      benchmark::Counter::kIs1000);
+}
+
+template <typename T>
+void BM_MulMatrixNaive(benchmark::State& state) {
+  size_t n = state.range(0);
+  S21Matrix<T> lhs = MakeRandom<T>(n, n);
+  S21Matrix<T> rhs = MakeRandom<T>(n, n);
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(NaiveMul(lhs, rhs));
+  }
+  SetFlops(state, n);
+}
+
+template <typename T>
+void BM_MulMatrix(benchmark::State& state) {
+  size_t n = state.range(0);
+  S21Matrix<T> lhs = MakeRandom<T>(n, n);
+  S21Matrix<T> rhs = MakeRandom<T>(n, n);
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(lhs * rhs);
+  }
+  SetFlops(state, n);
+}
+
+// float operands with double accumulators: the packing converts, the
+// kernel runs at double width
+void BM_MulMatrixFloatInDouble(benchmark::State& state) {
+  size_t n = state.range(0);
+  S21Matrix<float> lhs = MakeRandom<float>(n, n);
+  S21Matrix<float> rhs = MakeRandom<float>(n, n);
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(lhs.View().MulMatrix<double>(rhs.View()));
+  }
+  SetFlops(state, n);
+}
+
+}  // namespace
+
+BENCHMARK_TEMPLATE(BM_MulMatrixNaive, float)
+    ->RangeMultiplier(2)
+    ->Range(64, 4096)
+    ->Unit(benchmark::kMillisecond);
+BENCHMARK_TEMPLATE(BM_MulMatrix, float)
+    ->RangeMultiplier(2)
+    ->Range(64, 4096)
+    ->Unit(benchmark::kMillisecond);
+BENCHMARK_TEMPLATE(BM_MulMatrixNaive, double)
+    ->RangeMultiplier(2)
+    ->Range(64, 4096)
+    ->Unit(benchmark::kMillisecond);
+BENCHMARK_TEMPLATE(BM_MulMatrix, double)
+    ->RangeMultiplier(2)
+    ->Range(64, 4096)
+    ->Unit(benchmark::kMillisecond);
+BENCHMARK(BM_MulMatrixFloatInDouble)
+    ->RangeMultiplier(2)
+    ->Range(64, 4096)
+    ->Unit(benchmark::kMillisecond);
@@ -0,0 +1,95 @@
+#include <benchmark/benchmark.h>
+
+#include "s21_matrix_decompositions.h"
+
+namespace {
+
+S21Matrix<double> MakeWellConditioned(size_t n) {
+  S21Matrix<double> mtx(n, n);
+  unsigned seed = 777;
+  for (size_t r = 0; r < n; ++r) {
+    for (size_t c = 0; c < n; ++c) {
+      seed = seed * 1103515245u + 12345u;
+      mtx(r, c) = static_cast<double>((seed >> 8) % 1000) / 1000.0;
+    }
+    mtx(r, r) += static_cast<double>(n);
+  }
+  return mtx;
+}
+
+// InverseMatrix as it used to be: a determinant of a freshly allocated
+// minor for every cell of the adjugate, O(n^5) with n^2 allocations.
+S21Matrix<double> InverseByMinors(const S21Matrix<double>& mtx) {
+  size_t n = mtx.GetRows();
+  long double det = mtx.Determinant();
+  S21Matrix<double> adj(n, n);
+  for (size_t r = 0; r < n; ++r) {
+    for (size_t c = 0; c < n; ++c) {
+      adj(c, r) = ((r + c) % 2 ? -1 : 1) * mtx.Minor(r, c) / det;
+    }
+  }
+  return adj;
+}
+
+void BM_InverseByMinors(benchmark::State& state) {
+  S21Matrix<double> mtx = MakeWellConditioned(state.range(0));
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(InverseByMinors(mtx));
+  }
+}
+
+void BM_InverseMatrix(benchmark::State& state) {
+  S21Matrix<double> mtx = MakeWellConditioned(state.range(0));
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(mtx.InverseMatrix());
+  }
+}
+
+void BM_CalcComplements(benchmark::State& state) {
+  S21Matrix<double> mtx = MakeWellConditioned(state.range(0));
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(mtx.CalcComplements());
+  }
+}
+
+void BM_Determinant(benchmark::State& state) {
+  S21Matrix<double> mtx = MakeWellConditioned(state.range(0));
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(mtx.Determinant());
+  }
+}
+
+// a factorisation reused for both the determinant and the inverse
+void BM_LUReuse(benchmark::State& state) {
+  S21Matrix<double> mtx = MakeWellConditioned(state.range(0));
+  for (auto _ : state) {
+    s21::LU<double> lu(mtx);
+    benchmark::DoNotOptimize(lu.Determinant());
+    benchmark::DoNotOptimize(lu.Inverse());
+  }
+}
+
+}  // namespace
+
+// n = 500 by minors takes hours, 10 and 100 already show the gap
+BENCHMARK(BM_InverseByMinors)->Arg(10)->Arg(100)->Unit(benchmark::kMillisecond);
+BENCHMARK(BM_InverseMatrix)
+    ->Arg(10)
+    ->Arg(100)
+    ->Arg(500)
+    ->Unit(benchmark::kMillisecond);
+BENCHMARK(BM_CalcComplements)
+    ->Arg(10)
+    ->Arg(100)
+    ->Arg(500)
+    ->Unit(benchmark::kMillisecond);
+BENCHMARK(BM_Determinant)
+    ->Arg(10)
+    ->Arg(100)
+    ->Arg(500)
+    ->Unit(benchmark::kMillisecond);
+BENCHMARK(BM_LUReuse)
+    ->Arg(10)
+    ->Arg(100)
+    ->Arg(500)
+    ->Unit(benchmark::kMillisecond);
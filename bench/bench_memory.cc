@@ -0,0 +1,75 @@
+#include <benchmark/benchmark.h>
+
+#include "s21_matrix_oop.h"
+
+namespace {
+
+// A service-like loop: two small operands and the result of an
+// expression are created and destroyed on every iteration.
+void RunChurn(benchmark::State& state, std::pmr::memory_resource* resource,
+              s21::ArenaResource* arena = nullptr) {
+  size_t n = state.range(0);
+  for (auto _ : state) {
+    S21Matrix<double> lhs(n, n, 1.0, resource);
+    S21Matrix<double> rhs(n, n, 2.0, resource);
+    S21Matrix<double> res = lhs + rhs * 0.5;
+    benchmark::DoNotOptimize(res(0, 0));
+    if (arena) {
+      lhs = rhs = res = S21Matrix<double>();
+      arena->Reset();
+    }
+  }
+  state.SetItemsProcessed(state.iterations() * 3);
+}
+
+void BM_ChurnDefaultHeap(benchmark::State& state) {
+  RunChurn(state, std::pmr::new_delete_resource());
+}
+
+void BM_ChurnStdPool(benchmark::State& state) {
+  std::pmr::unsynchronized_pool_resource pool;
+  RunChurn(state, &pool);
+}
+
+void BM_ChurnPool(benchmark::State& state) {
+  s21::PoolResource pool;
+  RunChurn(state, &pool);
+}
+
+void BM_ChurnArena(benchmark::State& state) {
+  s21::ArenaResource arena;
+  RunChurn(state, &arena, &arena);
+}
+
+// Streaming ingestion: a matrix grown one row of 16 values at a time.
+void BM_AppendRow(benchmark::State& state) {
+  size_t rows = state.range(0);
+  S21Matrix<double> row(1, 16, 1.0);
+  for (auto _ : state) {
+    S21Matrix<double> mtx(0, 16);
+    for (size_t r = 0; r < rows; ++r) mtx.AppendRow(row);
+    benchmark::DoNotOptimize(mtx.Data());
+  }
+  state.SetItemsProcessed(state.iterations() * rows);
+}
+
+void BM_AppendRowReserved(benchmark::State& state) {
+  size_t rows = state.range(0);
+  S21Matrix<double> row(1, 16, 1.0);
+  for (auto _ : state) {
+    S21Matrix<double> mtx(0, 16);
+    mtx.Reserve(rows);
+    for (size_t r = 0; r < rows; ++r) mtx.AppendRow(row);
+    benchmark::DoNotOptimize(mtx.Data());
+  }
+  state.SetItemsProcessed(state.iterations() * rows);
+}
+
+}  // namespace
+
+BENCHMARK(BM_ChurnDefaultHeap)->Arg(2)->Arg(4)->Arg(16);
+BENCHMARK(BM_ChurnStdPool)->Arg(2)->Arg(4)->Arg(16);
+BENCHMARK(BM_ChurnPool)->Arg(2)->Arg(4)->Arg(16);
+BENCHMARK(BM_ChurnArena)->Arg(2)->Arg(4)->Arg(16);
+BENCHMARK(BM_AppendRow)->RangeMultiplier(16)->Range(16, 65536);
+BENCHMARK(BM_AppendRowReserved)->RangeMultiplier(16)->Range(16, 65536);
@@ -0,0 +1,218 @@
+#include <benchmark/benchmark.h>
+
+#include <cstdint>
+
+#include "s21_matrix_oop.h"
+
+// A baseline for every public S21Matrix operation across element types
+// and sizes. `make bench` stores the results as JSON and
+// `make bench-compare` checks them against bench/baseline.json.
+
+namespace {
+
+// diagonally dominant, so every size is comfortably invertible
+template <typename T>
+S21Matrix<T> MakeMatrix(size_t rows, size_t cols) {
+  S21Matrix<T> mtx(rows, cols);
+  unsigned seed = 4242;
+  for (size_t r = 0; r < rows; ++r) {
+    for (size_t c = 0; c < cols; ++c) {
+      seed = seed * 1103515245u + 12345u;
+      mtx(r, c) = static_cast<T>((seed >> 8) % 10);
+    }
+    if (r < cols) mtx(r, r) += static_cast<T>(10 * cols);
+  }
+  return mtx;
+}
+
+// Adding zeros costs the same and keeps integer elements from overflowing
+// over millions of iterations.
+template <typename T>
+void BM_OpSumMatrix(benchmark::State& state) {
+  size_t n = state.range(0);
+  auto lhs = MakeMatrix<T>(n, n);
+  S21Matrix<T> rhs(n, n);
+  for (auto _ : state) {
+    lhs.SumMatrix(rhs);
+    benchmark::ClobberMemory();
+  }
+  state.SetItemsProcessed(state.iterations() * n * n);
+}
+
+template <typename T>
+void BM_OpSubMatrix(benchmark::State& state) {
+  size_t n = state.range(0);
+  auto lhs = MakeMatrix<T>(n, n);
+  S21Matrix<T> rhs(n, n);
+  for (auto _ : state) {
+    lhs.SubMatrix(rhs);
+    benchmark::ClobberMemory();
+  }
+  state.SetItemsProcessed(state.iterations() * n * n);
+}
+
+template <typename T>
+void BM_OpMulNumber(benchmark::State& state) {
+  size_t n = state.range(0);
+  auto mtx = MakeMatrix<T>(n, n);
+  for (auto _ : state) {
+    mtx.MulNumber(1.0);
+    benchmark::ClobberMemory();
+  }
+  state.SetItemsProcessed(state.iterations() * n * n);
+}
+
+// equal matrices: the comparison cannot stop early
+template <typename T>
+void BM_OpEqMatrix(benchmark::State& state) {
+  size_t n = state.range(0);
+  auto lhs = MakeMatrix<T>(n, n), rhs = lhs;
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(lhs.EqMatrix(rhs));
+  }
+  state.SetItemsProcessed(state.iterations() * n * n);
+}
+
+template <typename T>
+void BM_OpMulMatrix(benchmark::State& state) {
+  size_t n = state.range(0);
+  auto lhs = MakeMatrix<T>(n, n), rhs = MakeMatrix<T>(n, n);
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(lhs * rhs);
+  }
+  state.SetItemsProcessed(state.iterations() * n * n * n);
+}
+
+template <typename T>
+void BM_OpTranspose(benchmark::State& state) {
+  size_t n = state.range(0);
+  auto mtx = MakeMatrix<T>(n, n);
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(mtx.Transpose());
+  }
+  state.SetItemsProcessed(state.iterations() * n * n);
+}
+
+template <typename T>
+void BM_OpDeterminant(benchmark::State& state) {
+  auto mtx = MakeMatrix<T>(state.range(0), state.range(0));
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(mtx.Determinant());
+  }
+}
+
+template <typename T>
+void BM_OpInverseMatrix(benchmark::State& state) {
+  auto mtx = MakeMatrix<T>(state.range(0), state.range(0));
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(mtx.InverseMatrix());
+  }
+}
+
+template <typename T>
+void BM_OpCalcComplements(benchmark::State& state) {
+  auto mtx = MakeMatrix<T>(state.range(0), state.range(0));
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(mtx.CalcComplements());
+  }
+}
+
+template <typename T>
+void BM_OpMinorMatrix(benchmark::State& state) {
+  size_t n = state.range(0);
+  auto mtx = MakeMatrix<T>(n, n);
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(mtx.MinorMatrix(n / 2, n / 2));
+  }
+  state.SetItemsProcessed(state.iterations() * n * n);
+}
+
+// reads every element through the checked operator()...
+template <typename T>
+void BM_OpElementAccess(benchmark::State& state) {
+  size_t n = state.range(0);
+  auto mtx = MakeMatrix<T>(n, n);
+  for (auto _ : state) {
+    T sum = 0;
+    for (size_t r = 0; r < n; ++r) {
+      for (size_t c = 0; c < n; ++c) sum += mtx(r, c);
+    }
+    benchmark::DoNotOptimize(sum);
+  }
+  state.SetItemsProcessed(state.iterations() * n * n);
+}
+
+// ...and through AtUnchecked. Without the checks integer sums vectorise;
+// floating ones stay bound by the chain of additions.
+template <typename T>
+void BM_OpElementAccessUnchecked(benchmark::State& state) {
+  size_t n = state.range(0);
+  auto mtx = MakeMatrix<T>(n, n);
+  for (auto _ : state) {
+    T sum = 0;
+    for (size_t r = 0; r < n; ++r) {
+      for (size_t c = 0; c < n; ++c) sum += mtx.AtUnchecked(r, c);
+    }
+    benchmark::DoNotOptimize(sum);
+  }
+  state.SetItemsProcessed(state.iterations() * n * n);
+}
+
+// grows by a quarter in both dimensions and shrinks back
+template <typename T>
+void BM_OpSetDim(benchmark::State& state) {
+  size_t n = state.range(0);
+  auto mtx = MakeMatrix<T>(n, n);
+  for (auto _ : state) {
+    mtx.SetDim(n + n / 4, n + n / 4);
+    mtx.SetDim(n, n);
+    benchmark::ClobberMemory();
+  }
+}
+
+}  // namespace
+
+#define S21_OPERATION_BENCHMARK(name, type) \
+  BENCHMARK_TEMPLATE(name, type)->Arg(8)->Arg(64)->Arg(256)->Arg(1024)
+
+// element-wise operations, products, transposes, resizing, minors and
+// element access for every element type
+#define S21_OPERATION_BENCHMARKS(type)                        \
+  S21_OPERATION_BENCHMARK(BM_OpSumMatrix, type);              \
+  S21_OPERATION_BENCHMARK(BM_OpSubMatrix, type);              \
+  S21_OPERATION_BENCHMARK(BM_OpMulNumber, type);              \
+  S21_OPERATION_BENCHMARK(BM_OpEqMatrix, type);               \
+  S21_OPERATION_BENCHMARK(BM_OpTranspose, type);              \
+  S21_OPERATION_BENCHMARK(BM_OpSetDim, type);                 \
+  S21_OPERATION_BENCHMARK(BM_OpMinorMatrix, type);            \
+  S21_OPERATION_BENCHMARK(BM_OpElementAccess, type);          \
+  S21_OPERATION_BENCHMARK(BM_OpElementAccessUnchecked, type); \
+  BENCHMARK_TEMPLATE(BM_OpMulMatrix, type)                    \
+      ->Arg(8)                                                \
+      ->Arg(64)                                               \
+      ->Arg(256)                                              \
+      ->Unit(benchmark::kMicrosecond);                        \
+  BENCHMARK_TEMPLATE(BM_OpDeterminant, type)                  \
+      ->Arg(8)                                                \
+      ->Arg(64)                                               \
+      ->Arg(256)                                              \
+      ->Unit(benchmark::kMicrosecond)
+
+// the factorisations are meaningful for floating types only
+#define S21_FACTORIZATION_BENCHMARKS(type)       \
+  BENCHMARK_TEMPLATE(BM_OpInverseMatrix, type)   \
+      ->Arg(8)                                   \
+      ->Arg(64)                                  \
+      ->Arg(256)                                 \
+      ->Unit(benchmark::kMicrosecond);           \
+  BENCHMARK_TEMPLATE(BM_OpCalcComplements, type) \
+      ->Arg(8)                                   \
+      ->Arg(64)                                  \
+      ->Arg(256)                                 \
+      ->Unit(benchmark::kMicrosecond)
+
+S21_OPERATION_BENCHMARKS(float);
+S21_OPERATION_BENCHMARKS(double);
+S21_OPERATION_BENCHMARKS(std::int32_t);
+S21_FACTORIZATION_BENCHMARKS(float);
+S21_FACTORIZATION_BENCHMARKS(double);
@@ -0,0 +1,95 @@
+#include <benchmark/benchmark.h>
+
+#include <cmath>
+#include <filesystem>
+#include <string>
+
+#include "s21_matrix_out_of_core.h"
+
+namespace {
+
+// small enough that the products below take a second or less
+constexpr size_t kBudget = size_t{16} << 20;
+
+S21Matrix<double> MakeMatrix(size_t n, unsigned seed) {
+  S21Matrix<double> mtx(n, n);
+  for (size_t r = 0; r < n; ++r) {
+    for (size_t c = 0; c < n; ++c) {
+      seed = seed * 1103515245u + 12345u;
+      mtx(r, c) = static_cast<double>((seed >> 8) % 2001) / 1000 - 1;
+    }
+  }
+  return mtx;
+}
+
+std::string TempPath(const char* name) {
+  return (std::filesystem::temp_directory_path() / name).string();
+}
+
+// the order of square matrices whose A, B and C files together take
+// `ratio` times the budget
+size_t OrderFor(benchmark::State& state) {
+  double bytes = static_cast<double>(state.range(0)) * kBudget;
+  return static_cast<size_t>(std::sqrt(bytes / (3 * sizeof(double))));
+}
+
+void SetFlops(benchmark::State& state, size_t n) {
+  double order = static_cast<double>(n);
+  state.counters["n"] = order;
+  state.counters["flops"] =
+      benchmark::Counter(2.0 * order * order * order,
+                         benchmark::Counter::kIsIterationInvariantRate);
+}
+
+// Operands on disk (most likely in the page cache, so the reads cost
+// copies rather than seeks); the second argument turns prefetch on.
+void BM_OutOfCoreMulMatrix(benchmark::State& state) {
+  size_t n = OrderFor(state);
+  std::string lhs = TempPath("s21_bench_ooc_lhs.bin");
+  std::string rhs = TempPath("s21_bench_ooc_rhs.bin");
+  std::string out = TempPath("s21_bench_ooc_out.bin");
+  s21::SaveBinary(lhs, MakeMatrix(n, 1));
+  s21::SaveBinary(rhs, MakeMatrix(n, 2));
+  s21::OutOfCoreOptions options{kBudget, state.range(1) != 0};
+  s21::OutOfCoreReport report;
+  for (auto _ : state) {
+    report = s21::OutOfCoreMulMatrix<double>(lhs, rhs, out, options);
+  }
+  std::filesystem::remove(lhs);
+  std::filesystem::remove(rhs);
+  std::filesystem::remove(out);
+  SetFlops(state, n);
+  state.counters["read"] = benchmark::Counter(
+      static_cast<double>(report.bytes_read),
+      benchmark::Counter::kIsIterationInvariantRate,
+      benchmark::Counter::kIs1024);
+  state.counters["tile"] = static_cast<double>(report.tile_rows);
+  // seconds of the last run spent waiting for tiles
+  state.counters["stall"] = report.stall_nanoseconds * 1e-9;
+}
+
+// the same product with everything in memory, for reference
+void BM_InMemoryMulMatrix(benchmark::State& state) {
+  size_t n = OrderFor(state);
+  auto lhs = MakeMatrix(n, 1);
+  auto rhs = MakeMatrix(n, 2);
+  S21Matrix<double> res;
+  for (auto _ : state) {
+    res = lhs * rhs;
+    benchmark::DoNotOptimize(res.Data());
+  }
+  SetFlops(state, n);
+}
+
+}  // namespace
+
+// the first argument is the size of the data in budgets
+BENCHMARK(BM_OutOfCoreMulMatrix)
+    ->ArgsProduct({{2, 4}, {0, 1}})
+    ->ArgNames({"budgets", "prefetch"})
+    ->Unit(benchmark::kMillisecond);
+BENCHMARK(BM_InMemoryMulMatrix)
+    ->Arg(2)
+    ->Arg(4)
+    ->ArgName("budgets")
+    ->Unit(benchmark::kMillisecond);
@@ -0,0 +1,134 @@
+#include <benchmark/benchmark.h>
+
+#include <cmath>
+
+#include "s21_matrix_oop.h"
+
+namespace {
+
+template <typename T>
+S21Matrix<T> MakeMatrix(size_t n) {
+  S21Matrix<T> mtx(n, n);
+  unsigned seed = 7;
+  for (size_t r = 0; r < n; ++r) {
+    for (size_t c = 0; c < n; ++c) {
+      seed = seed * 1103515245u + 12345u;
+      mtx(r, c) = static_cast<T>((seed >> 8) % 2001) / 1000 - 1;
+    }
+  }
+  return mtx;
+}
+
+// the loops callers wrote before the reductions, through the
+// bounds-checked operator()
+template <typename T>
+T NaiveSum(const S21Matrix<T>& mtx) {
+  T sum = 0;
+  for (size_t r = 0; r < mtx.GetRows(); ++r) {
+    for (size_t c = 0; c < mtx.GetCols(); ++c) sum += mtx(r, c);
+  }
+  return sum;
+}
+
+template <typename T>
+T NaiveFrobenius(const S21Matrix<T>& mtx) {
+  T sum = 0;
+  for (size_t r = 0; r < mtx.GetRows(); ++r) {
+    for (size_t c = 0; c < mtx.GetCols(); ++c) sum += mtx(r, c) * mtx(r, c);
+  }
+  return std::sqrt(sum);
+}
+
+// column by column, as the definition reads
+template <typename T>
+T NaiveNorm1(const S21Matrix<T>& mtx) {
+  T norm = 0;
+  for (size_t c = 0; c < mtx.GetCols(); ++c) {
+    T sum = 0;
+    for (size_t r = 0; r < mtx.GetRows(); ++r) sum += std::fabs(mtx(r, c));
+    norm = std::fmax(norm, sum);
+  }
+  return norm;
+}
+
+template <typename T>
+T NaiveMax(const S21Matrix<T>& mtx) {
+  T max = mtx(0, 0);
+  for (size_t r = 0; r < mtx.GetRows(); ++r) {
+    for (size_t c = 0; c < mtx.GetCols(); ++c) max = std::fmax(max, mtx(r, c));
+  }
+  return max;
+}
+
+template <typename T>
+T NaiveDot(const S21Matrix<T>& lhs, const S21Matrix<T>& rhs) {
+  T sum = 0;
+  for (size_t r = 0; r < lhs.GetRows(); ++r) {
+    for (size_t c = 0; c < lhs.GetCols(); ++c) sum += lhs(r, c) * rhs(r, c);
+  }
+  return sum;
+}
+
+enum Reduction { kSum, kFrobenius, kNorm1, kMax, kDot };
+
+template <typename T>
+void BM_Naive(benchmark::State& state) {
+  auto mtx = MakeMatrix<T>(state.range(0)), other = mtx;
+  for (auto _ : state) {
+    switch (state.range(1)) {
+      case kSum:
+        benchmark::DoNotOptimize(NaiveSum(mtx));
+        break;
+      case kFrobenius:
+        benchmark::DoNotOptimize(NaiveFrobenius(mtx));
+        break;
+      case kNorm1:
+        benchmark::DoNotOptimize(NaiveNorm1(mtx));
+        break;
+      case kMax:
+        benchmark::DoNotOptimize(NaiveMax(mtx));
+        break;
+      default:
+        benchmark::DoNotOptimize(NaiveDot(mtx, other));
+        break;
+    }
+  }
+  state.SetItemsProcessed(state.iterations() * mtx.GetRows() * mtx.GetCols());
+}
+
+template <typename T>
+void BM_Reduce(benchmark::State& state) {
+  auto mtx = MakeMatrix<T>(state.range(0)), other = mtx;
+  for (auto _ : state) {
+    switch (state.range(1)) {
+      case kSum:
+        benchmark::DoNotOptimize(mtx.Sum());
+        break;
+      case kFrobenius:
+        benchmark::DoNotOptimize(mtx.NormFrobenius());
+        break;
+      case kNorm1:
+        benchmark::DoNotOptimize(mtx.Norm1());
+        break;
+      case kMax:
+        benchmark::DoNotOptimize(mtx.Max());
+        break;
+      default:
+        benchmark::DoNotOptimize(mtx.Dot(other));
+        break;
+    }
+  }
+  state.SetItemsProcessed(state.iterations() * mtx.GetRows() * mtx.GetCols());
+}
+
+}  // namespace
+
+// the second argument is the Reduction
+#define S21_REDUCE_BENCHMARK(name)                        \
+  name->ArgsProduct({benchmark::CreateRange(64, 2048, 4), \
+                     {kSum, kFrobenius, kNorm1, kMax, kDot}})
+
+S21_REDUCE_BENCHMARK(BENCHMARK_TEMPLATE(BM_Naive, double));
+S21_REDUCE_BENCHMARK(BENCHMARK_TEMPLATE(BM_Reduce, double));
+S21_REDUCE_BENCHMARK(BENCHMARK_TEMPLATE(BM_Naive, float));
+S21_REDUCE_BENCHMARK(BENCHMARK_TEMPLATE(BM_Reduce, float));
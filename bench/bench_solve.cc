@@ -0,0 +1,64 @@
+#include <benchmark/benchmark.h>
+
+#include "s21_matrix_decompositions.h"
+
+namespace {
+
+// B^T * B + n * I: symmetric positive definite, so every factorisation
+// applies
+S21Matrix<double> MakeSpd(size_t n) {
+  S21Matrix<double> base(n, n);
+  unsigned seed = 4242;
+  for (size_t r = 0; r < n; ++r) {
+    for (size_t c = 0; c < n; ++c) {
+      seed = seed * 1103515245u + 12345u;
+      base(r, c) = static_cast<double>((seed >> 8) % 1000) / 1000.0;
+    }
+  }
+  S21Matrix<double> spd = base.Transpose() * base;
+  for (size_t r = 0; r < n; ++r) spd(r, r) += static_cast<double>(n);
+  return spd;
+}
+
+// args: n, right-hand sides per solve
+void BM_SolveByInverse(benchmark::State& state) {
+  S21Matrix<double> mtx = MakeSpd(state.range(0));
+  S21Matrix<double> rhs(state.range(0), state.range(1));
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(mtx.InverseMatrix() * rhs);
+  }
+}
+
+// the factor is computed once outside the loop and reused
+template <typename Factorization>
+void BM_SolveFactored(benchmark::State& state) {
+  S21Matrix<double> mtx = MakeSpd(state.range(0));
+  S21Matrix<double> rhs(state.range(0), state.range(1));
+  Factorization factors(mtx);
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(factors.Solve(rhs));
+  }
+}
+
+}  // namespace
+
+BENCHMARK(BM_SolveByInverse)
+    ->Args({100, 1})
+    ->Args({500, 1})
+    ->Args({500, 16})
+    ->Unit(benchmark::kMicrosecond);
+BENCHMARK_TEMPLATE(BM_SolveFactored, s21::LU<double>)
+    ->Args({100, 1})
+    ->Args({500, 1})
+    ->Args({500, 16})
+    ->Unit(benchmark::kMicrosecond);
+BENCHMARK_TEMPLATE(BM_SolveFactored, s21::Cholesky<double>)
+    ->Args({100, 1})
+    ->Args({500, 1})
+    ->Args({500, 16})
+    ->Unit(benchmark::kMicrosecond);
+BENCHMARK_TEMPLATE(BM_SolveFactored, s21::QR<double>)
+    ->Args({100, 1})
+    ->Args({500, 1})
+    ->Args({500, 16})
+    ->Unit(benchmark::kMicrosecond);
@@ -0,0 +1,93 @@
+#include <benchmark/benchmark.h>
+
+#include <vector>
+
+#include "s21_matrix_sparse.h"
+
+namespace {
+
+// one element in `period` is nonzero
+S21Matrix<double> MakeSparseDense(size_t n, unsigned period) {
+  S21Matrix<double> mtx(n, n);
+  unsigned seed = 2024;
+  for (size_t r = 0; r < n; ++r) {
+    for (size_t c = 0; c < n; ++c) {
+      seed = seed * 1103515245u + 12345u;
+      if ((seed >> 8) % period == 0) mtx(r, c) = (seed >> 16) % 19 - 9.0;
+    }
+  }
+  return mtx;
+}
+
+// Args: size, one nonzero in `period` elements (100 = 1% density)
+
+void BM_DenseMulVector(benchmark::State& state) {
+  size_t n = state.range(0);
+  auto mtx = MakeSparseDense(n, state.range(1));
+  S21Matrix<double> x(n, 1, 1.0);
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(mtx * x);
+  }
+}
+
+void BM_SparseMulVector(benchmark::State& state) {
+  size_t n = state.range(0);
+  S21SparseMatrix<double> mtx(MakeSparseDense(n, state.range(1)));
+  std::vector<double> x(n, 1.0), y(n);
+  for (auto _ : state) {
+    mtx.MulVector(x.data(), y.data());
+    benchmark::ClobberMemory();
+  }
+}
+
+void BM_DenseMulMatrix(benchmark::State& state) {
+  size_t n = state.range(0);
+  auto mtx = MakeSparseDense(n, state.range(1));
+  S21Matrix<double> rhs(n, 64, 1.0);
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(mtx * rhs);
+  }
+}
+
+void BM_SparseMulMatrix(benchmark::State& state) {
+  size_t n = state.range(0);
+  S21SparseMatrix<double> mtx(MakeSparseDense(n, state.range(1)));
+  S21Matrix<double> rhs(n, 64, 1.0);
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(mtx * rhs);
+  }
+}
+
+void BM_DenseSum(benchmark::State& state) {
+  size_t n = state.range(0);
+  auto lhs = MakeSparseDense(n, state.range(1));
+  auto rhs = lhs;
+  for (auto _ : state) {
+    lhs += rhs;
+    benchmark::ClobberMemory();
+  }
+}
+
+void BM_SparseSum(benchmark::State& state) {
+  size_t n = state.range(0);
+  S21SparseMatrix<double> lhs(MakeSparseDense(n, state.range(1)));
+  auto rhs = lhs;
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(lhs + rhs);
+  }
+}
+
+}  // namespace
+
+#define S21_SPARSE_BENCHMARK(name) \
+  BENCHMARK(name)                  \
+      ->Args({2000, 20})           \
+      ->Args({2000, 100})          \
+      ->Unit(benchmark::kMicrosecond)
+
+S21_SPARSE_BENCHMARK(BM_DenseMulVector);
+S21_SPARSE_BENCHMARK(BM_SparseMulVector);
+S21_SPARSE_BENCHMARK(BM_DenseMulMatrix);
+S21_SPARSE_BENCHMARK(BM_SparseMulMatrix);
+S21_SPARSE_BENCHMARK(BM_DenseSum);
+S21_SPARSE_BENCHMARK(BM_SparseSum);
@@ -0,0 +1,84 @@
+#include <benchmark/benchmark.h>
+
+#include "s21_matrix_static.h"
+
+namespace {
+
+template <size_t N>
+S21StaticMatrix<double, N, N> MakeInvertible() {
+  S21StaticMatrix<double, N, N> mtx;
+  for (size_t r = 0; r < N; ++r) {
+    for (size_t c = 0; c < N; ++c) {
+      mtx(r, c) = (r == c) ? N + 1.0 : static_cast<double>((r * 7 + c) % 5);
+    }
+  }
+  return mtx;
+}
+
+// S21Matrix keeps up to 4x4 doubles inline, larger ones on the heap
+template <size_t N>
+void BM_DynamicMul(benchmark::State& state) {
+  S21Matrix<double> mtx = MakeInvertible<N>().ToMatrix();
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(mtx * mtx);
+  }
+}
+
+template <size_t N>
+void BM_StaticMul(benchmark::State& state) {
+  S21StaticMatrix<double, N, N> mtx = MakeInvertible<N>();
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(mtx);
+    benchmark::DoNotOptimize(mtx * mtx);
+  }
+}
+
+template <size_t N>
+void BM_DynamicDeterminant(benchmark::State& state) {
+  S21Matrix<double> mtx = MakeInvertible<N>().ToMatrix();
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(mtx.Determinant());
+  }
+}
+
+template <size_t N>
+void BM_StaticDeterminant(benchmark::State& state) {
+  S21StaticMatrix<double, N, N> mtx = MakeInvertible<N>();
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(mtx);
+    benchmark::DoNotOptimize(mtx.Determinant());
+  }
+}
+
+template <size_t N>
+void BM_DynamicInverse(benchmark::State& state) {
+  S21Matrix<double> mtx = MakeInvertible<N>().ToMatrix();
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(mtx.InverseMatrix());
+  }
+}
+
+template <size_t N>
+void BM_StaticInverse(benchmark::State& state) {
+  S21StaticMatrix<double, N, N> mtx = MakeInvertible<N>();
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(mtx);
+    benchmark::DoNotOptimize(mtx.InverseMatrix());
+  }
+}
+
+}  // namespace
+
+#define S21_STATIC_BENCHMARKS(name) \
+  BENCHMARK_TEMPLATE(name, 2);      \
+  BENCHMARK_TEMPLATE(name, 3);      \
+  BENCHMARK_TEMPLATE(name, 4);      \
+  BENCHMARK_TEMPLATE(name, 6);      \
+  BENCHMARK_TEMPLATE(name, 8)
+
+S21_STATIC_BENCHMARKS(BM_DynamicMul);
+S21_STATIC_BENCHMARKS(BM_StaticMul);
+S21_STATIC_BENCHMARKS(BM_DynamicDeterminant);
+S21_STATIC_BENCHMARKS(BM_StaticDeterminant);
+S21_STATIC_BENCHMARKS(BM_DynamicInverse);
+S21_STATIC_BENCHMARKS(BM_StaticInverse);
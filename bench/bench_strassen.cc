@@ -0,0 +1,94 @@
+#include <benchmark/benchmark.h>
+
+#include <algorithm>
+#include <cmath>
+#include <type_traits>
+
+#include "s21_matrix_strassen.h"
+
+namespace {
+
+template <typename T>
+S21Matrix<T> MakeMatrix(size_t n, unsigned seed) {
+  S21Matrix<T> mtx(n, n);
+  for (size_t r = 0; r < n; ++r) {
+    for (size_t c = 0; c < n; ++c) {
+      seed = seed * 1103515245u + 12345u;
+      mtx(r, c) = static_cast<T>((seed >> 8) % 2001) / 1000 - 1;
+    }
+  }
+  return mtx;
+}
+
+void SetFlops(benchmark::State& state) {
+  double n = static_cast<double>(state.range(0));
+  state.counters["flops"] = benchmark::Counter(
+      2.0 * n * n * n, benchmark::Counter::kIsIterationInvariantRate);
+}
+
+// The largest deviation of a float product from the exact one, computed
+// in double, relative to the largest element of that product.
+void SetError(benchmark::State& state, const S21Matrix<float>& res,
+              const S21Matrix<float>& lhs, const S21Matrix<float>& rhs) {
+  S21Matrix<double> exact = S21Matrix<double>(lhs) * S21Matrix<double>(rhs);
+  double error = 0.0, scale = 0.0;
+  for (size_t r = 0; r < exact.GetRows(); ++r) {
+    for (size_t c = 0; c < exact.GetCols(); ++c) {
+      error = std::max(error, std::fabs(res(r, c) - exact(r, c)));
+      scale = std::max(scale, std::fabs(exact(r, c)));
+    }
+  }
+  state.counters["rel_error"] = scale ? error / scale : 0.0;
+}
+
+template <typename T>
+void BM_ClassicMulMatrix(benchmark::State& state) {
+  auto lhs = MakeMatrix<T>(state.range(0), 1);
+  auto rhs = MakeMatrix<T>(state.range(0), 2);
+  S21Matrix<T> res;
+  for (auto _ : state) {
+    res = lhs * rhs;
+    benchmark::DoNotOptimize(res.Data());
+  }
+  SetFlops(state);
+  if constexpr (std::is_same_v<T, float>) SetError(state, res, lhs, rhs);
+}
+
+template <typename T>
+void BM_StrassenMulMatrix(benchmark::State& state) {
+  auto lhs = MakeMatrix<T>(state.range(0), 1);
+  auto rhs = MakeMatrix<T>(state.range(0), 2);
+  S21Matrix<T> res;
+  for (auto _ : state) {
+    res = s21::StrassenMulMatrix<T>(lhs, rhs, state.range(1));
+    benchmark::DoNotOptimize(res.Data());
+  }
+  SetFlops(state);
+  if constexpr (std::is_same_v<T, float>) SetError(state, res, lhs, rhs);
+}
+
+}  // namespace
+
+// A classic 8192 x 8192 product in double takes about a minute per run,
+// so sizes stop at 2048 unless e.g. -DS21_BENCH_STRASSEN_MAX=8192 is given.
+#ifndef S21_BENCH_STRASSEN_MAX
+#define S21_BENCH_STRASSEN_MAX 2048
+#endif
+
+#define S21_CLASSIC_BENCHMARK(name)          \
+  name->RangeMultiplier(2)                   \
+      ->Range(512, S21_BENCH_STRASSEN_MAX) \
+      ->Unit(benchmark::kMillisecond)
+
+// the second argument is the cutoff
+#define S21_STRASSEN_BENCHMARK(name)                                    \
+  name->ArgsProduct({benchmark::CreateRange(512, S21_BENCH_STRASSEN_MAX, \
+                                            2),                         \
+                     {256, 512}})                                       \
+      ->ArgNames({"n", "cutoff"})                                       \
+      ->Unit(benchmark::kMillisecond)
+
+S21_CLASSIC_BENCHMARK(BENCHMARK_TEMPLATE(BM_ClassicMulMatrix, double));
+S21_CLASSIC_BENCHMARK(BENCHMARK_TEMPLATE(BM_ClassicMulMatrix, float));
+S21_STRASSEN_BENCHMARK(BENCHMARK_TEMPLATE(BM_StrassenMulMatrix, double));
+S21_STRASSEN_BENCHMARK(BENCHMARK_TEMPLATE(BM_StrassenMulMatrix, float));
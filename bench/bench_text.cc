@@ -0,0 +1,103 @@
+#include <benchmark/benchmark.h>
+
+#include <sstream>
+#include <string>
+
+#include "s21_matrix_text.h"
+
+namespace {
+
+S21Matrix<double> MakeRandom(size_t rows, size_t cols) {
+  S21Matrix<double> mtx(rows, cols);
+  unsigned seed = 2024;
+  for (size_t r = 0; r < rows; ++r) {
+    for (size_t c = 0; c < cols; ++c) {
+      seed = seed * 1103515245u + 12345u;
+      mtx(r, c) = static_cast<double>(seed >> 8) / 3.0;
+    }
+  }
+  return mtx;
+}
+
+// MB/s of text produced or consumed
+void SetThroughput(benchmark::State& state, size_t text_bytes) {
+  state.counters["Throughput"] = benchmark::Counter(
+      static_cast<double>(text_bytes),
+      benchmark::Counter::kIsIterationInvariantRate,
+      benchmark::Counter::kIs1000);
+}
+
+// the old text path: Repr() through std::to_string, 6 decimals, no reader
+void BM_WriteRepr(benchmark::State& state) {
+  size_t n = state.range(0);
+  auto mtx = MakeRandom(n, n);
+  size_t bytes = 0;
+  for (auto _ : state) {
+    std::ostringstream os;
+    os << mtx;
+    bytes = os.tellp();
+  }
+  SetThroughput(state, bytes);
+}
+
+void BM_WriteCsv(benchmark::State& state) {
+  size_t n = state.range(0);
+  auto mtx = MakeRandom(n, n);
+  size_t bytes = 0;
+  for (auto _ : state) {
+    std::ostringstream os;
+    s21::WriteCsv(os, mtx);
+    bytes = os.tellp();
+  }
+  SetThroughput(state, bytes);
+}
+
+void BM_ReadCsv(benchmark::State& state) {
+  size_t n = state.range(0);
+  std::ostringstream os;
+  s21::WriteCsv(os, MakeRandom(n, n));
+  std::string text = os.str();
+  for (auto _ : state) {
+    std::istringstream is(text);
+    benchmark::DoNotOptimize(s21::ReadCsv<double>(is));
+  }
+  SetThroughput(state, text.size());
+}
+
+void BM_WriteMatrixMarket(benchmark::State& state) {
+  size_t n = state.range(0);
+  auto mtx = MakeRandom(n, n);
+  size_t bytes = 0;
+  for (auto _ : state) {
+    std::ostringstream os;
+    s21::WriteMatrixMarket(os, mtx);
+    bytes = os.tellp();
+  }
+  SetThroughput(state, bytes);
+}
+
+void BM_ReadMatrixMarket(benchmark::State& state) {
+  size_t n = state.range(0);
+  std::ostringstream os;
+  s21::WriteMatrixMarket(os, MakeRandom(n, n));
+  std::string text = os.str();
+  for (auto _ : state) {
+    std::istringstream is(text);
+    benchmark::DoNotOptimize(s21::ReadMatrixMarket<double>(is));
+  }
+  SetThroughput(state, text.size());
+}
+
+}  // namespace
+
+BENCHMARK(BM_WriteRepr)->Arg(64)->Arg(512)->Unit(benchmark::kMillisecond);
+BENCHMARK(BM_WriteCsv)->Arg(64)->Arg(512)->Unit(benchmark::kMillisecond);
+BENCHMARK(BM_ReadCsv)->Arg(64)->Arg(512)->Unit(benchmark::kMillisecond);
+BENCHMARK(BM_WriteMatrixMarket)
+    ->Arg(64)
+    ->Arg(512)
+    ->Unit(benchmark::kMillisecond);
+BENCHMARK(BM_ReadMatrixMarket)
+    ->Arg(64)
+    ->Arg(512)
+    ->Unit(benchmark::kMillisecond);
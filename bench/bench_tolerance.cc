@@ -0,0 +1,85 @@
+#include <benchmark/benchmark.h>
+
+#include <cmath>
+
+#include "s21_matrix_oop.h"
+
+namespace {
+
+template <typename T>
+S21Matrix<T> MakeMatrix(size_t n) {
+  S21Matrix<T> mtx(n, n);
+  unsigned seed = 7;
+  for (size_t r = 0; r < n; ++r) {
+    for (size_t c = 0; c < n; ++c) {
+      seed = seed * 1103515245u + 12345u;
+      mtx(r, c) = static_cast<T>((seed >> 8) % 2001) / 1000 - 1;
+    }
+  }
+  return mtx;
+}
+
+// the loop callers wrote before the tolerance policies, with a relative
+// check through the bounds-checked operator()
+template <typename T>
+bool NaiveRelative(const S21Matrix<T>& lhs, const S21Matrix<T>& rhs,
+                   double rel) {
+  for (size_t r = 0; r < lhs.GetRows(); ++r) {
+    for (size_t c = 0; c < lhs.GetCols(); ++c) {
+      double x = lhs(r, c), y = rhs(r, c);
+      if (std::fabs(x - y) > rel * std::fmax(std::fabs(x), std::fabs(y))) {
+        return false;
+      }
+    }
+  }
+  return true;
+}
+
+// equal matrices, so every element is compared
+template <typename T>
+void BM_NaiveRelative(benchmark::State& state) {
+  auto lhs = MakeMatrix<T>(state.range(0)), rhs = lhs;
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(NaiveRelative(lhs, rhs, 1e-6));
+  }
+  state.SetItemsProcessed(state.iterations() * lhs.GetRows() * lhs.GetCols());
+}
+
+template <typename T, typename Tolerance>
+void BM_EqMatrixTolerance(benchmark::State& state) {
+  auto lhs = MakeMatrix<T>(state.range(0)), rhs = lhs;
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(lhs.EqMatrix(rhs, Tolerance{}));
+  }
+  state.SetItemsProcessed(state.iterations() * lhs.GetRows() * lhs.GetCols());
+}
+
+// a mismatch in the first row: the scan stops after one chunk
+template <typename T>
+void BM_EqMatrixEarlyExit(benchmark::State& state) {
+  auto lhs = MakeMatrix<T>(state.range(0)), rhs = lhs;
+  rhs(0, 1) += 1;
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(lhs.EqMatrix(rhs, s21::UlpTolerance{}));
+  }
+}
+
+}  // namespace
+
+#define S21_TOLERANCE_BENCHMARK(name) name->RangeMultiplier(4)->Range(64, 2048)
+
+S21_TOLERANCE_BENCHMARK(BENCHMARK_TEMPLATE(BM_NaiveRelative, double));
+S21_TOLERANCE_BENCHMARK(BENCHMARK_TEMPLATE(BM_NaiveRelative, float));
+S21_TOLERANCE_BENCHMARK(
+    BENCHMARK_TEMPLATE(BM_EqMatrixTolerance, double, s21::AbsoluteTolerance));
+S21_TOLERANCE_BENCHMARK(
+    BENCHMARK_TEMPLATE(BM_EqMatrixTolerance, double, s21::RelativeTolerance));
+S21_TOLERANCE_BENCHMARK(
+    BENCHMARK_TEMPLATE(BM_EqMatrixTolerance, double, s21::UlpTolerance));
+S21_TOLERANCE_BENCHMARK(
+    BENCHMARK_TEMPLATE(BM_EqMatrixTolerance, float, s21::RelativeTolerance));
+S21_TOLERANCE_BENCHMARK(
+    BENCHMARK_TEMPLATE(BM_EqMatrixTolerance, float, s21::UlpTolerance));
+S21_TOLERANCE_BENCHMARK(
+    BENCHMARK_TEMPLATE(BM_EqMatrixTolerance, int, s21::UlpTolerance));
+S21_TOLERANCE_BENCHMARK(BENCHMARK_TEMPLATE(BM_EqMatrixEarlyExit, double));
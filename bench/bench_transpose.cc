@@ -0,0 +1,82 @@
+#include <benchmark/benchmark.h>
+
+#include <cstring>
+
+#include "s21_matrix_oop.h"
+
+namespace {
+
+S21Matrix<double> MakeRandom(size_t rows, size_t cols) {
+  S21Matrix<double> mtx(rows, cols);
+  unsigned seed = 2024;
+  for (size_t r = 0; r < rows; ++r) {
+    for (size_t c = 0; c < cols; ++c) {
+      seed = seed * 1103515245u + 12345u;
+      mtx(r, c) = static_cast<double>(seed >> 8);
+    }
+  }
+  return mtx;
+}
+
+// every element is read once and written once
+void SetBandwidth(benchmark::State& state, size_t elements) {
+  state.counters["Bandwidth"] = benchmark::Counter(
+      2.0 * elements * sizeof(double),
+      benchmark::Counter::kIsIterationInvariantRate,
+      benchmark::Counter::kIs1024);
+}
+
+// the ceiling: a plain copy of the same number of bytes
+void BM_Memcpy(benchmark::State& state) {
+  size_t n = state.range(0);
+  S21Matrix<double> src = MakeRandom(n, n);
+  S21Matrix<double> dst(n, n);
+  for (auto _ : state) {
+    std::memcpy(&dst(0, 0), &src(0, 0), n * n * sizeof(double));
+    benchmark::ClobberMemory();
+  }
+  SetBandwidth(state, n * n);
+}
+
+// The row-by-row loop Transpose used before the blocked kernel.
+void BM_TransposeNaive(benchmark::State& state) {
+  size_t n = state.range(0);
+  S21Matrix<double> src = MakeRandom(n, n);
+  S21Matrix<double> dst(n, n);
+  for (auto _ : state) {
+    for (size_t r = 0; r < n; ++r) {
+      for (size_t c = 0; c < n; ++c) dst(c, r) = src(r, c);
+    }
+    benchmark::ClobberMemory();
+  }
+  SetBandwidth(state, n * n);
+}
+
+// includes allocating the result, which dominates for large matrices
+void BM_Transpose(benchmark::State& state) {
+  size_t n = state.range(0);
+  S21Matrix<double> src = MakeRandom(n, n);
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(src.Transpose());
+  }
+  SetBandwidth(state, n * n);
+}
+
+void BM_TransposeInPlace(benchmark::State& state) {
+  size_t n = state.range(0);
+  S21Matrix<double> mtx = MakeRandom(n, n);
+  for (auto _ : state) {
+    mtx.TransposeInPlace();
+    benchmark::ClobberMemory();
+  }
+  SetBandwidth(state, n * n);
+}
+
+}  // namespace
+
+// 4096 is a power of two: the worst case for the naive loop's
+// column-strided writes, which all map to the same cache sets
+BENCHMARK(BM_Memcpy)->Arg(256)->Arg(1000)->Arg(4096);
+BENCHMARK(BM_TransposeNaive)->Arg(256)->Arg(1000)->Arg(4096);
+BENCHMARK(BM_Transpose)->Arg(256)->Arg(1000)->Arg(4096);
+BENCHMARK(BM_TransposeInPlace)->Arg(256)->Arg(1000)->Arg(4096);
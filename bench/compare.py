@@ -0,0 +1,81 @@
+#!/usr/bin/env python3
+"""Compares two Google Benchmark JSON reports and flags regressions.
+
+    compare.py BASELINE CURRENT [--threshold 0.10] [--metric cpu_time]
+
+Benchmarks are matched by name. With --benchmark_repetitions the median
+aggregate is used, otherwise the single run. A benchmark regresses when
+its time grows by more than the threshold (a fraction of the baseline).
+The exit status is 1 if anything regressed, so the script can gate CI.
+"""
+
+import argparse
+import json
+import sys
+
+# nanoseconds per Google Benchmark time unit
+UNITS = {"ns": 1.0, "us": 1e3, "ms": 1e6, "s": 1e9}
+
+
+def load(path, metric):
+    """Maps benchmark names to times in nanoseconds."""
+    with open(path, encoding="utf-8") as report:
+        entries = json.load(report)["benchmarks"]
+    times = {}
+    medians = {}
+    for entry in entries:
+        if entry.get("error_occurred"):
+            continue
+        name = entry.get("run_name", entry["name"])
+        value = entry[metric] * UNITS[entry.get("time_unit", "ns")]
+        if entry.get("run_type") == "aggregate":
+            if entry.get("aggregate_name") == "median":
+                medians[name] = value
+        else:
+            times.setdefault(name, value)
+    times.update(medians)
+    return times
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__.splitlines()[0])
+    parser.add_argument("baseline")
+    parser.add_argument("current")
+    parser.add_argument("--threshold", type=float, default=0.10,
+                        help="allowed slowdown, a fraction (default 0.10)")
+    parser.add_argument("--metric", choices=("cpu_time", "real_time"),
+                        default="cpu_time")
+    args = parser.parse_args()
+
+    baseline = load(args.baseline, args.metric)
+    current = load(args.current, args.metric)
+
+    regressions = 0
+    width = max((len(name) for name in current), default=10)
+    print(f"{'benchmark':<{width}}  {'baseline':>12}  {'current':>12}  change")
+    for name, now in current.items():
+        before = baseline.get(name)
+        if before is None:
+            print(f"{name:<{width}}  {'-':>12}  {now:>10.0f}ns  new")
+            continue
+        change = (now - before) / before if before else 0.0
+        flag = ""
+        if change > args.threshold:
+            flag = "  REGRESSION"
+            regressions += 1
+        elif change < -args.threshold:
+            flag = "  improved"
+        print(f"{name:<{width}}  {before:>10.0f}ns  {now:>10.0f}ns  "
+              f"{change:+7.1%}{flag}")
+    for name in sorted(baseline.keys() - current.keys()):
+        print(f"{name:<{width}}  missing from the current run")
+
+    if regressions:
+        print(f"{regressions} benchmark(s) slower by more than "
+              f"{args.threshold:.0%}", file=sys.stderr)
+        return 1
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
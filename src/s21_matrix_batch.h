@@ -0,0 +1,401 @@
+#ifndef S21_MATRIXPLUSPLUS_SRC_S21_MATRIX_BATCH_H_
+#define S21_MATRIXPLUSPLUS_SRC_S21_MATRIX_BATCH_H_
+
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <limits>
+#include <memory_resource>
+#include <stdexcept>
+#include <string>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "s21_matrix_lu.h"
+#include "s21_matrix_oop.h"
+#include "s21_matrix_thread_pool.h"
+
+namespace s21 {
+
+// Matrix after matrix (kAos), or element (r, c) of every matrix followed
+// by the next element (kSoa).
+enum class BatchLayout { kAos, kSoa };
+
+namespace detail {
+
+// Batches are processed in groups of this many matrices, the lanes. The
+// factorisations work on a copy of a group that holds element (r, c) of
+// lane l at w[(r * n + c) * kBatchLanes + l], so each of their steps is a
+// loop over contiguous lanes, and pivoting is a per-lane select.
+inline constexpr std::size_t kBatchLanes = 64;
+
+// Gaussian elimination with partial pivoting of `lanes` n x n matrices at
+// once. det[l] receives the determinant of lane l. Given `inv` holding
+// identity matrices, the elimination continues to Gauss-Jordan and leaves
+// the inverses there. A column whose pivot is below eps in magnitude
+// makes the determinant of its lane zero; the lane still runs through
+// every step, with a unit pivot, so the others are not held up.
+template <typename W>
+void BatchEliminate(W* w, W* inv, std::size_t n, std::size_t lanes, W* det,
+                    double eps) noexcept {
+  constexpr std::size_t kL = kBatchLanes;
+  std::size_t piv[kL];
+  W best[kL], pivot[kL];
+  std::fill_n(det, lanes, W{1});
+  auto at = [&](W* m, std::size_t r, std::size_t c) {
+    return m + (r * n + c) * kL;
+  };
+  for (std::size_t k = 0; k < n; ++k) {
+    const W* diag = at(w, k, k);
+    for (std::size_t l = 0; l < lanes; ++l) {
+      piv[l] = k;
+      best[l] = std::abs(diag[l]);
+    }
+    for (std::size_t r = k + 1; r < n; ++r) {
+      const W* v = at(w, r, k);
+      for (std::size_t l = 0; l < lanes; ++l) {
+        bool better = std::abs(v[l]) > best[l];
+        best[l] = better ? std::abs(v[l]) : best[l];
+        piv[l] = better ? r : piv[l];
+      }
+    }
+    // row k trades places with the pivot row of each lane
+    auto swap_rows = [&](W* m, std::size_t r, std::size_t from) {
+      for (std::size_t j = from; j < n; ++j) {
+        W* a = at(m, k, j);
+        W* b = at(m, r, j);
+        for (std::size_t l = 0; l < lanes; ++l) {
+          bool swap = piv[l] == r;
+          W x = a[l], y = b[l];
+          a[l] = swap ? y : x;
+          b[l] = swap ? x : y;
+        }
+      }
+    };
+    for (std::size_t r = k + 1; r < n; ++r) {
+      swap_rows(w, r, k);
+      if (inv) swap_rows(inv, r, 0);
+    }
+    for (std::size_t l = 0; l < lanes; ++l) {
+      bool singular = best[l] < eps;
+      W sign = piv[l] != k ? W{-1} : W{1};
+      det[l] = singular ? W{} : det[l] * sign * diag[l];
+      pivot[l] = singular ? W{1} : diag[l];
+    }
+    if (!inv) {
+      for (std::size_t r = k + 1; r < n; ++r) {
+        W* row = at(w, r, 0);
+        W factor[kL];
+        for (std::size_t l = 0; l < lanes; ++l) {
+          factor[l] = row[k * kL + l] / pivot[l];
+        }
+        for (std::size_t j = k + 1; j < n; ++j) {
+          const W* src = at(w, k, j);
+          W* dst = at(w, r, j);
+          for (std::size_t l = 0; l < lanes; ++l) dst[l] -= factor[l] * src[l];
+        }
+      }
+      continue;
+    }
+    // Gauss-Jordan: scale the pivot row to a unit pivot, then clear
+    // column k in every other row
+    for (std::size_t j = 0; j < n; ++j) {
+      W* b = at(inv, k, j);
+      for (std::size_t l = 0; l < lanes; ++l) b[l] /= pivot[l];
+      if (j < k) continue;
+      W* a = at(w, k, j);
+      for (std::size_t l = 0; l < lanes; ++l) a[l] /= pivot[l];
+    }
+    for (std::size_t r = 0; r < n; ++r) {
+      if (r == k) continue;
+      W factor[kL];
+      std::copy_n(at(w, r, k), lanes, factor);
+      for (std::size_t j = 0; j < n; ++j) {
+        const W* src = at(inv, k, j);
+        W* dst = at(inv, r, j);
+        for (std::size_t l = 0; l < lanes; ++l) dst[l] -= factor[l] * src[l];
+        if (j < k) continue;
+        src = at(w, k, j);
+        dst = at(w, r, j);
+        for (std::size_t l = 0; l < lanes; ++l) dst[l] -= factor[l] * src[l];
+      }
+    }
+  }
+}
+
+}  // namespace detail
+
+}  // namespace s21
+
+// N matrices of the same shape in one contiguous buffer, for workloads of
+// many small independent matrices (3x3 rotations, 4x4 transforms) where a
+// loop over S21Matrix objects is dominated by allocations and per-call
+// overhead. The batched operations process the matrices in groups of
+// lanes: with the default SoA layout element (r, c) of consecutive
+// matrices is contiguous, so their loops vectorise across the batch. AoS
+// keeps each matrix contiguous, which suits handing single matrices to
+// other code. Groups are spread across threads by the execution policy.
+template <typename T, s21::BatchLayout L = s21::BatchLayout::kSoa,
+          typename = typename std::enable_if<std::is_arithmetic<T>::value,
+                                             T>::type>
+class S21MatrixBatch {
+ public:
+  using value_type = T;
+  using size_type = std::size_t;
+  using allocator_type = std::pmr::polymorphic_allocator<T>;
+  // element type of determinants and of the factorisations' working copy
+  using Real = s21::detail::LuReal<T>;
+  static constexpr s21::BatchLayout kLayout = L;
+  static constexpr bool kIsSoa = L == s21::BatchLayout::kSoa;
+
+ public:
+  // `count` zero rows x cols matrices
+  explicit S21MatrixBatch(size_type count = 0, size_type rows = 0,
+                          size_type cols = 0,
+                          const allocator_type& alloc = {})
+      : _count(count),
+        _rows(rows),
+        _cols(cols),
+        _data(count * rows * cols, alloc) {}
+
+  // `count` copies of `mtx`
+  S21MatrixBatch(size_type count, const S21MatrixView<const T>& mtx,
+                 const allocator_type& alloc = {})
+      : S21MatrixBatch(count, mtx.GetRows(), mtx.GetCols(), alloc) {
+    for (size_type i = 0; i < count; ++i) Set(i, mtx);
+  }
+
+  // a copy of matrix i
+  S21Matrix<T> Get(size_type i) const {
+    CheckIndexUpperBound(i, _count);
+    S21Matrix<T> mtx(_rows, _cols, GetAllocator());
+    for (size_type r = 0; r < _rows; ++r) {
+      for (size_type c = 0; c < _cols; ++c) {
+        mtx.AtUnchecked(r, c) = _data[Index(i, r, c)];
+      }
+    }
+    return mtx;
+  }
+
+  // overwrites matrix i with `mtx` of the batch's shape
+  void Set(size_type i, const S21MatrixView<const T>& mtx) {
+    CheckIndexUpperBound(i, _count);
+    if (mtx.GetRows() != _rows || mtx.GetCols() != _cols) {
+      throw std::logic_error(
+          std::string("Size mismatch: this ") +
+          s21::detail::DimString(_rows, _cols) + " != other " +
+          s21::detail::DimString(mtx.GetRows(), mtx.GetCols()));
+    }
+    for (size_type r = 0; r < _rows; ++r) {
+      for (size_type c = 0; c < _cols; ++c) {
+        _data[Index(i, r, c)] = mtx.Eval(r, c);
+      }
+    }
+  }
+
+  // main operations
+
+  // the products of corresponding matrices
+  S21MatrixBatch MulMatrix(const S21MatrixBatch& other) const {
+    CheckIsEqualCount(other);
+    if (_cols != other._rows) {
+      std::string errmsg = std::string("this cols (") + std::to_string(_cols) +
+                           std::string(" != other rows (") +
+                           std::to_string(other._rows) + std::string(")");
+      throw std::logic_error(errmsg);
+    }
+    size_type n = other._cols;
+    S21MatrixBatch res(_count, _rows, n, GetAllocator());
+    ForEachGroup(_rows * _cols * n, [&](size_type begin, size_type end) {
+      size_type lanes = end - begin;
+      T acc[kLanes];
+      for (size_type r = 0; r < _rows; ++r) {
+        for (size_type c = 0; c < n; ++c) {
+          std::fill_n(acc, lanes, T{});
+          for (size_type k = 0; k < _cols; ++k) {
+            const T* a = Lane(r * _cols + k) + begin * MatrixStep();
+            const T* b = other.Lane(k * n + c) + begin * other.MatrixStep();
+            for (size_type l = 0; l < lanes; ++l) {
+              acc[l] += a[l * MatrixStep()] * b[l * other.MatrixStep()];
+            }
+          }
+          T* out = res.Lane(r * n + c) + begin * res.MatrixStep();
+          for (size_type l = 0; l < lanes; ++l) {
+            out[l * res.MatrixStep()] = acc[l];
+          }
+        }
+      }
+    });
+    return res;
+  }
+
+  S21MatrixBatch Transpose() const {
+    S21MatrixBatch res(_count, _cols, _rows, GetAllocator());
+    ForEachGroup(_rows * _cols, [&](size_type begin, size_type end) {
+      for (size_type r = 0; r < _rows; ++r) {
+        for (size_type c = 0; c < _cols; ++c) {
+          const T* src = Lane(r * _cols + c);
+          T* dst = res.Lane(c * _rows + r);
+          for (size_type i = begin; i < end; ++i) {
+            dst[i * res.MatrixStep()] = src[i * MatrixStep()];
+          }
+        }
+      }
+    });
+    return res;
+  }
+
+  // the determinant of every matrix, allocated from the batch's resource
+  std::pmr::vector<Real> Determinant() const {
+    CheckIsSquareMatrix();
+    std::pmr::vector<Real> det(_count, GetAllocator().resource());
+    size_type n = _rows;
+    ForEachGroup(n * n * n, [&](size_type begin, size_type end) {
+      std::vector<Real> work(n * n * kLanes);
+      Load(work.data(), begin, end);
+      s21::detail::BatchEliminate<Real>(work.data(), nullptr, n, end - begin,
+                                        det.data() + begin, kEps);
+    });
+    return det;
+  }
+
+  // Throws std::logic_error naming the first singular matrix met.
+  S21MatrixBatch InverseMatrix() const {
+    CheckIsSquareMatrix();
+    S21MatrixBatch res(_count, _rows, _cols, GetAllocator());
+    size_type n = _rows;
+    ForEachGroup(2 * n * n * n, [&](size_type begin, size_type end) {
+      std::vector<Real> work(n * n * kLanes), inv(n * n * kLanes);
+      Real det[kLanes];
+      Load(work.data(), begin, end);
+      for (size_type r = 0; r < n; ++r) {
+        std::fill_n(inv.data() + (r * n + r) * kLanes, kLanes, Real{1});
+      }
+      s21::detail::BatchEliminate(work.data(), inv.data(), n, end - begin,
+                                  det, kEps);
+      for (size_type i = begin; i < end; ++i) {
+        if (std::abs(det[i - begin]) < kEps) {
+          throw std::logic_error("The determinant of matrix " +
+                                 std::to_string(i) + " is zero.");
+        }
+      }
+      res.Store(inv.data(), begin, end);
+    });
+    return res;
+  }
+
+  // getters
+  size_type GetCount() const noexcept { return _count; }
+  size_type GetRows() const noexcept { return _rows; }
+  size_type GetCols() const noexcept { return _cols; }
+  allocator_type GetAllocator() const noexcept {
+    return _data.get_allocator();
+  }
+
+  // Raw storage: element (r, c) of matrix i is Data()[Index(i, r, c)].
+  T* Data() noexcept { return _data.data(); }
+  const T* Data() const noexcept { return _data.data(); }
+  size_type Index(size_type i, size_type row, size_type col) const noexcept {
+    return (row * _cols + col) * ElementStep() + i * MatrixStep();
+  }
+
+  // operators
+
+  // element (row, col) of matrix i
+  T& operator()(size_type i, size_type row, size_type col) {
+    return const_cast<T&>(std::as_const(*this)(i, row, col));
+  }
+
+  const T& operator()(size_type i, size_type row, size_type col) const {
+    CheckIndexUpperBound(i, _count);
+    CheckIndexUpperBound(row, _rows);
+    CheckIndexUpperBound(col, _cols);
+    return _data[Index(i, row, col)];
+  }
+
+  S21MatrixBatch operator*(const S21MatrixBatch& other) const {
+    return MulMatrix(other);
+  }
+
+ private:
+  static constexpr size_type kLanes = s21::detail::kBatchLanes;
+  static constexpr double kEps = std::numeric_limits<double>::epsilon();
+
+  // distance between element e and element e + 1 of one matrix, and
+  // between element e of matrix i and of matrix i + 1
+  size_type ElementStep() const noexcept { return kIsSoa ? _count : 1; }
+  size_type MatrixStep() const noexcept { return kIsSoa ? 1 : _rows * _cols; }
+
+  // element e = r * cols + c of matrix i is Lane(e)[i * MatrixStep()]
+  T* Lane(size_type e) noexcept { return _data.data() + e * ElementStep(); }
+  const T* Lane(size_type e) const noexcept {
+    return _data.data() + e * ElementStep();
+  }
+
+  // Calls body(begin, end) for groups of at most kLanes matrices, the
+  // groups spread across threads; `cost` is the work per matrix.
+  template <typename F>
+  void ForEachGroup(size_type cost, F&& body) const {
+    s21::ParallelFor(
+        _count, cost,
+        [&](size_type begin, size_type end) {
+          for (size_type i = begin; i < end; i += kLanes) {
+            body(i, std::min(end, i + kLanes));
+          }
+        },
+        kLanes);
+  }
+
+  // copies matrices [begin, end) into the lanes of a working buffer
+  void Load(Real* work, size_type begin, size_type end) const {
+    for (size_type e = 0; e < _rows * _cols; ++e) {
+      const T* src = Lane(e);
+      for (size_type i = begin; i < end; ++i) {
+        work[e * kLanes + i - begin] = static_cast<Real>(src[i * MatrixStep()]);
+      }
+    }
+  }
+
+  // and back
+  void Store(const Real* work, size_type begin, size_type end) {
+    for (size_type e = 0; e < _rows * _cols; ++e) {
+      T* dst = Lane(e);
+      for (size_type i = begin; i < end; ++i) {
+        dst[i * MatrixStep()] = static_cast<T>(work[e * kLanes + i - begin]);
+      }
+    }
+  }
+
+  void CheckIndexUpperBound(size_type idx, size_type upper) const {
+    if (idx >= upper) {
+      std::string errmsg = "index ";
+      errmsg += std::to_string(idx);
+      errmsg += " >= ";
+      errmsg += std::to_string(upper);
+      throw std::out_of_range(errmsg);
+    }
+  }
+
+  void CheckIsEqualCount(const S21MatrixBatch& other) const {
+    if (_count != other._count) {
+      throw std::logic_error("Batch size mismatch: this " +
+                             std::to_string(_count) + " != other " +
+                             std::to_string(other._count));
+    }
+  }
+
+  void CheckIsSquareMatrix() const {
+    if (_rows != _cols) {
+      std::string errmsg = std::string("rows = ") + std::to_string(_rows) +
+                           std::string(" is not equal to cols = ") +
+                           std::to_string(_cols);
+      throw std::logic_error(errmsg);
+    }
+  }
+
+  size_type _count, _rows, _cols;
+  std::pmr::vector<T> _data;
+};
+
+#endif  // S21_MATRIXPLUSPLUS_SRC_S21_MATRIX_BATCH_H_
@@ -0,0 +1,389 @@
+#ifndef S21_MATRIXPLUSPLUS_SRC_S21_MATRIX_BINARY_H_
+#define S21_MATRIXPLUSPLUS_SRC_S21_MATRIX_BINARY_H_
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include <algorithm>
+#include <cerrno>
+#include <cstdint>
+#include <cstring>
+#include <fstream>
+#include <iostream>
+#include <stdexcept>
+#include <string>
+#include <system_error>
+#include <type_traits>
+
+#include "s21_matrix_oop.h"
+
+// A compact binary file format for S21Matrix: a 64-byte header followed
+// by the elements, row after row, exactly as they are in memory. Saving
+// and loading stream whole rows, and MappedMatrix maps a file read-only
+// and views its elements in place, with no copy at all.
+//
+// Header fields are stored in the byte order of the writer, which the
+// `endianness` byte records; ReadBinary converts a foreign byte order,
+// MappedMatrix refuses it. The elements start at `data_offset`, a multiple
+// of 2^alignment_log2 bytes, and consecutive rows are `stride` elements
+// apart.
+namespace s21 {
+
+struct BinaryHeader {
+  char magic[8];
+  std::uint32_t version;
+  char kind;  // 'b' bool, 'i' signed, 'u' unsigned integer, 'f' floating
+  std::uint8_t element_size;
+  std::uint8_t endianness;  // kLittleEndian or kBigEndian
+  std::uint8_t alignment_log2;
+  std::uint64_t rows;
+  std::uint64_t cols;
+  std::uint64_t stride;
+  std::uint64_t data_offset;
+  std::uint8_t reserved[16];
+};
+
+static_assert(sizeof(BinaryHeader) == 64, "the header is one cache line");
+
+inline constexpr char kBinaryMagic[8] = {'S', '2', '1', 'M',
+                                         'T', 'R', 'X', '\0'};
+inline constexpr std::uint32_t kBinaryVersion = 1;
+inline constexpr std::uint8_t kLittleEndian = 1;
+inline constexpr std::uint8_t kBigEndian = 2;
+// the elements start on a cache line, and so on a page when mapped
+inline constexpr std::uint8_t kBinaryAlignmentLog2 = 6;
+
+namespace detail {
+
+#if defined(__BYTE_ORDER__) && __BYTE_ORDER__ == __ORDER_BIG_ENDIAN__
+inline constexpr std::uint8_t kHostEndianness = kBigEndian;
+#else
+inline constexpr std::uint8_t kHostEndianness = kLittleEndian;
+#endif
+
+template <typename T>
+constexpr char BinaryKind() noexcept {
+  if constexpr (std::is_same_v<T, bool>) {
+    return 'b';
+  } else if constexpr (std::is_floating_point_v<T>) {
+    return 'f';
+  } else if constexpr (std::is_signed_v<T>) {
+    return 'i';
+  } else {
+    return 'u';
+  }
+}
+
+template <typename T>
+void ByteSwap(T& value) noexcept {
+  auto* bytes = reinterpret_cast<unsigned char*>(&value);
+  std::reverse(bytes, bytes + sizeof(T));
+}
+
+template <typename T>
+void ByteSwap(T* values, std::size_t n) noexcept {
+  for (std::size_t i = 0; i < n; ++i) ByteSwap(values[i]);
+}
+
+inline std::string TypeString(char kind, std::size_t size) {
+  return std::string(1, kind) + std::to_string(size);
+}
+
+// bytes from the first element to the end of the last one, given a stride
+// for which rows * stride elements fit in 64 bits
+inline std::uint64_t BinaryDataBytes(const BinaryHeader& header,
+                                     std::size_t element_size) noexcept {
+  if (!header.rows) return 0;
+  return ((header.rows - 1) * header.stride + header.cols) * element_size;
+}
+
+// Validates `header` for elements of type T, converting its integers
+// to the host byte order first if needed. Returns whether the elements
+// need converting too.
+template <typename T>
+bool CheckBinaryHeader(BinaryHeader& header) {
+  if (std::memcmp(header.magic, kBinaryMagic, sizeof(kBinaryMagic))) {
+    throw std::runtime_error("not an S21Matrix binary file");
+  }
+  if (header.endianness != kLittleEndian && header.endianness != kBigEndian) {
+    throw std::runtime_error("corrupt header: unknown byte order " +
+                             std::to_string(header.endianness));
+  }
+  bool foreign = header.endianness != kHostEndianness;
+  if (foreign) {
+    ByteSwap(header.version);
+    ByteSwap(header.rows);
+    ByteSwap(header.cols);
+    ByteSwap(header.stride);
+    ByteSwap(header.data_offset);
+  }
+  if (header.version != kBinaryVersion) {
+    throw std::runtime_error("unsupported version " +
+                             std::to_string(header.version));
+  }
+  if (header.kind != BinaryKind<T>() || header.element_size != sizeof(T)) {
+    throw std::runtime_error(
+        "element type mismatch: the file has " +
+        TypeString(header.kind, header.element_size) + ", expected " +
+        TypeString(BinaryKind<T>(), sizeof(T)));
+  }
+  // the rows, and then the whole extent from the start of the file, must
+  // fit in 64 bits: a wrapped extent would pass any size check
+  std::uint64_t max_elements = UINT64_MAX / sizeof(T);
+  if (header.stride < header.cols ||
+      (header.rows && header.stride > max_elements / header.rows) ||
+      header.data_offset < sizeof(BinaryHeader) ||
+      header.data_offset % sizeof(T) ||
+      header.data_offset > UINT64_MAX - BinaryDataBytes(header, sizeof(T))) {
+    throw std::runtime_error("corrupt header: bad layout");
+  }
+  return foreign;
+}
+
+// bytes from the start of the file to the end of the last element, for a
+// header accepted by CheckBinaryHeader
+inline std::uint64_t BinaryExtent(const BinaryHeader& header,
+                                  std::size_t element_size) noexcept {
+  return header.data_offset + BinaryDataBytes(header, element_size);
+}
+
+// Skips `bytes` bytes of `is`, which may exceed what one ignore() takes.
+inline void SkipBytes(std::istream& is, std::uint64_t bytes) {
+  constexpr std::uint64_t kMaxSkip = std::uint64_t{1} << 30;
+  while (bytes && is) {
+    std::uint64_t step = std::min(bytes, kMaxSkip);
+    is.ignore(static_cast<std::streamsize>(step));
+    bytes -= step;
+  }
+}
+
+// Whether a seekable `is`, positioned just after `header`, is too short
+// to hold the elements. Unseekable streams are only found short by reading.
+inline bool IsShorterThan(std::istream& is, const BinaryHeader& header,
+                          std::size_t element_size) {
+  std::istream::pos_type here = is.tellg();
+  if (here == std::istream::pos_type(-1)) return false;
+  is.seekg(0, std::ios::end);
+  std::istream::pos_type end = is.tellg();
+  is.seekg(here);
+  if (end == std::istream::pos_type(-1) || !is) {
+    is.clear();
+    is.seekg(here);
+    return false;
+  }
+  std::uint64_t left = static_cast<std::uint64_t>(end - here);
+  return BinaryExtent(header, element_size) - sizeof(header) > left;
+}
+
+// the header of a densely packed rows x cols matrix of T
+template <typename T>
+BinaryHeader MakeBinaryHeader(std::uint64_t rows, std::uint64_t cols) {
+  BinaryHeader header{};
+  std::copy(std::begin(kBinaryMagic), std::end(kBinaryMagic), header.magic);
+  header.version = kBinaryVersion;
+  header.kind = BinaryKind<T>();
+  header.element_size = sizeof(T);
+  header.endianness = kHostEndianness;
+  header.alignment_log2 = kBinaryAlignmentLog2;
+  header.rows = rows;
+  header.cols = cols;
+  header.stride = cols;
+  header.data_offset = sizeof(BinaryHeader);
+  return header;
+}
+
+}  // namespace detail
+
+// Writes the rows x cols elements of `mtx`, densely packed.
+template <typename T>
+void WriteBinary(std::ostream& os, S21MatrixView<T> mtx) {
+  using value_type = typename S21MatrixView<T>::value_type;
+  BinaryHeader header =
+      detail::MakeBinaryHeader<value_type>(mtx.GetRows(), mtx.GetCols());
+  os.write(reinterpret_cast<const char*>(&header), sizeof(header));
+  std::size_t row_bytes = mtx.GetCols() * sizeof(value_type);
+  if (mtx.GetStride() == mtx.GetCols()) {
+    os.write(reinterpret_cast<const char*>(mtx.Data()),
+             mtx.GetRows() * row_bytes);
+  } else {
+    for (std::size_t r = 0; r < mtx.GetRows(); ++r) {
+      os.write(reinterpret_cast<const char*>(mtx.RowData(r)), row_bytes);
+    }
+  }
+  if (!os) throw std::runtime_error("failed to write the matrix");
+}
+
+template <typename T>
+void WriteBinary(std::ostream& os, const S21Matrix<T>& mtx) {
+  WriteBinary(os, mtx.View());
+}
+
+// Reads a matrix written by WriteBinary straight into its storage.
+template <typename T>
+S21Matrix<T> ReadBinary(
+    std::istream& is,
+    const typename S21Matrix<T>::allocator_type& alloc = {}) {
+  BinaryHeader header;
+  if (!is.read(reinterpret_cast<char*>(&header), sizeof(header))) {
+    throw std::runtime_error("truncated header");
+  }
+  bool foreign = detail::CheckBinaryHeader<T>(header);
+  // nothing is allocated or skipped for elements the stream cannot hold
+  if (detail::IsShorterThan(is, header, sizeof(T))) {
+    throw std::runtime_error("truncated matrix data");
+  }
+  detail::SkipBytes(is, header.data_offset - sizeof(header));
+  S21Matrix<T> mtx(header.rows, header.cols, alloc);
+  std::size_t row_bytes = header.cols * sizeof(T);
+  std::size_t gap = (header.stride - header.cols) * sizeof(T);
+  if (!gap && mtx.GetStride() == mtx.GetCols()) {
+    is.read(reinterpret_cast<char*>(mtx.Data()), header.rows * row_bytes);
+  } else {
+    for (std::size_t r = 0; r < header.rows && is; ++r) {
+      if (r && gap) detail::SkipBytes(is, gap);
+      is.read(reinterpret_cast<char*>(mtx.RowData(r)), row_bytes);
+    }
+  }
+  if (!is) throw std::runtime_error("truncated matrix data");
+  if (foreign) {
+    for (std::size_t r = 0; r < header.rows; ++r) {
+      detail::ByteSwap(mtx.RowData(r), header.cols);
+    }
+  }
+  return mtx;
+}
+
+template <typename M>
+void SaveBinary(const std::string& path, const M& mtx) {
+  std::ofstream file(path, std::ios::binary | std::ios::trunc);
+  if (!file) throw std::runtime_error("cannot open " + path);
+  WriteBinary(file, mtx);
+  file.close();
+  if (!file) throw std::runtime_error("failed to write " + path);
+}
+
+template <typename T>
+S21Matrix<T> LoadBinary(
+    const std::string& path,
+    const typename S21Matrix<T>::allocator_type& alloc = {}) {
+  std::ifstream file(path, std::ios::binary);
+  if (!file) throw std::runtime_error("cannot open " + path);
+  return ReadBinary<T>(file, alloc);
+}
+
+// A binary matrix file mapped read-only into memory. View() refers to the
+// elements in the mapping, so opening a file of any size costs no copy;
+// pages are read in by the kernel on first access and shared with the
+// page cache. The file must be in the host byte order.
+template <typename T>
+class MappedMatrix {
+ public:
+  using value_type = T;
+  using size_type = std::size_t;
+
+ public:
+  explicit MappedMatrix(const std::string& path) {
+    int fd = ::open(path.c_str(), O_RDONLY);
+    if (fd < 0) {
+      throw std::system_error(errno, std::generic_category(),
+                              "cannot open " + path);
+    }
+    struct stat st;
+    if (::fstat(fd, &st) < 0) {
+      int error = errno;
+      ::close(fd);
+      throw std::system_error(error, std::generic_category(),
+                              "cannot stat " + path);
+    }
+    if (static_cast<std::uint64_t>(st.st_size) < sizeof(BinaryHeader)) {
+      ::close(fd);
+      throw std::runtime_error("truncated header");
+    }
+    _length = st.st_size;
+    _base = ::mmap(nullptr, _length, PROT_READ, MAP_PRIVATE, fd, 0);
+    int error = errno;
+    ::close(fd);  // the mapping keeps the file open
+    if (_base == MAP_FAILED) {
+      _base = nullptr;
+      throw std::system_error(error, std::generic_category(),
+                              "cannot map " + path);
+    }
+    try {
+      Attach();
+    } catch (...) {
+      Unmap();
+      throw;
+    }
+  }
+
+  MappedMatrix(const MappedMatrix&) = delete;
+  MappedMatrix& operator=(const MappedMatrix&) = delete;
+
+  MappedMatrix(MappedMatrix&& other) noexcept { Swap(other); }
+
+  MappedMatrix& operator=(MappedMatrix&& other) noexcept {
+    if (this != &other) {
+      Unmap();
+      Swap(other);
+    }
+    return *this;
+  }
+
+  ~MappedMatrix() noexcept { Unmap(); }
+
+  // valid while this object is alive
+  S21MatrixView<const T> View() const noexcept {
+    return S21MatrixView<const T>(_data, _rows, _cols, _stride);
+  }
+  S21Matrix<T> ToMatrix() const { return View().ToMatrix(); }
+
+  size_type GetRows() const noexcept { return _rows; }
+  size_type GetCols() const noexcept { return _cols; }
+
+ private:
+  void Attach() {
+    BinaryHeader header;
+    std::memcpy(&header, _base, sizeof(header));
+    if (detail::CheckBinaryHeader<T>(header)) {
+      throw std::runtime_error(
+          "the file has a foreign byte order; use LoadBinary");
+    }
+    if (detail::BinaryExtent(header, sizeof(T)) > _length) {
+      throw std::runtime_error("truncated matrix data");
+    }
+    _data = reinterpret_cast<const T*>(static_cast<const char*>(_base) +
+                                       header.data_offset);
+    _rows = header.rows;
+    _cols = header.cols;
+    _stride = header.stride;
+  }
+
+  void Unmap() noexcept {
+    if (_base) ::munmap(_base, _length);
+    _base = nullptr;
+    _length = 0;
+    _data = nullptr;
+    _rows = _cols = _stride = 0;
+  }
+
+  void Swap(MappedMatrix& other) noexcept {
+    std::swap(_base, other._base);
+    std::swap(_length, other._length);
+    std::swap(_data, other._data);
+    std::swap(_rows, other._rows);
+    std::swap(_cols, other._cols);
+    std::swap(_stride, other._stride);
+  }
+
+  void* _base{nullptr};
+  size_type _length{0};
+  const T* _data{nullptr};
+  size_type _rows{0}, _cols{0};
+  size_type _stride{0};
+};
+
+}  // namespace s21
+
+#endif  // S21_MATRIXPLUSPLUS_SRC_S21_MATRIX_BINARY_H_
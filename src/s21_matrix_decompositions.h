@@ -0,0 +1,357 @@
+#ifndef S21_MATRIXPLUSPLUS_SRC_S21_MATRIX_DECOMPOSITIONS_H_
+#define S21_MATRIXPLUSPLUS_SRC_S21_MATRIX_DECOMPOSITIONS_H_
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include "s21_matrix_lu.h"
+#include "s21_matrix_oop.h"
+#include "s21_matrix_thread_pool.h"
+
+// Factorisations that are computed once in O(n^3) and then reused:
+// Solve(rhs) takes any number of right-hand sides as the columns of rhs
+// and costs O(n^2) per column.
+namespace s21 {
+namespace detail {
+
+template <typename W, typename T>
+std::vector<W> ToBuffer(const S21Matrix<T>& mtx) {
+  std::size_t rows = mtx.GetRows(), cols = mtx.GetCols();
+  std::vector<W> buffer(rows * cols);
+  for (std::size_t r = 0; r < rows; ++r) {
+    std::copy_n(mtx.RowData(r), cols, buffer.data() + r * cols);
+  }
+  return buffer;
+}
+
+template <typename T, typename W>
+S21Matrix<T> FromBuffer(const W* buffer, std::size_t rows, std::size_t cols,
+                        std::size_t ld) {
+  S21Matrix<T> mtx(rows, cols);
+  for (std::size_t r = 0; r < rows; ++r) {
+    std::copy_n(buffer + r * ld, cols, mtx.RowData(r));
+  }
+  return mtx;
+}
+
+inline void CheckIsSquare(const char* what, std::size_t rows,
+                          std::size_t cols) {
+  if (rows != cols) {
+    throw std::logic_error(std::string(what) + " of a non-square matrix " +
+                           DimString(rows, cols));
+  }
+}
+
+inline void CheckRhsRows(std::size_t expected, std::size_t rows) {
+  if (expected != rows) {
+    throw std::logic_error(std::string("rhs rows (") + std::to_string(rows) +
+                           ") != matrix rows (" + std::to_string(expected) +
+                           ")");
+  }
+}
+
+}  // namespace detail
+
+// P * A = L * U with partial pivoting.
+template <typename T>
+class LU {
+ public:
+  using size_type = std::size_t;
+  using value_type = detail::LuReal<T>;
+
+ public:
+  explicit LU(const S21Matrix<T>& matrix)
+      : _size(matrix.GetRows()), _perm(_size) {
+    detail::CheckIsSquare("LU", matrix.GetRows(), matrix.GetCols());
+    _lu = detail::ToBuffer<value_type>(matrix);
+    _info = detail::LuFactor(_lu.data(), _size, _size, _perm.data(), kEps);
+  }
+
+  size_type GetSize() const noexcept { return _size; }
+  bool IsSingular() const noexcept { return _info.singular; }
+
+  long double Determinant() const noexcept {
+    return detail::LuDeterminant(_lu.data(), _size, _size, _info);
+  }
+
+  // X with A * X = rhs, one column of X per column of rhs
+  S21Matrix<T> Solve(const S21Matrix<T>& rhs) const {
+    CheckIsNonsingular();
+    detail::CheckRhsRows(_size, rhs.GetRows());
+    size_type nrhs = rhs.GetCols();
+    std::vector<value_type> x(_size * nrhs);
+    for (size_type r = 0; r < _size; ++r) {
+      for (size_type c = 0; c < nrhs; ++c) {
+        x[r * nrhs + c] = static_cast<value_type>(rhs(_perm[r], c));
+      }
+    }
+    detail::LuSolveInPlace(_lu.data(), _size, _size, x.data(), nrhs, nrhs);
+    return detail::FromBuffer<T>(x.data(), _size, nrhs, nrhs);
+  }
+
+  S21Matrix<T> Inverse() const {
+    CheckIsNonsingular();
+    std::vector<value_type> inv(_size * _size);
+    detail::LuInverse(_lu.data(), _size, _size, _perm.data(), inv.data(),
+                      _size);
+    return detail::FromBuffer<T>(inv.data(), _size, _size, _size);
+  }
+
+  // unit lower triangular factor
+  S21Matrix<value_type> GetLower() const {
+    S21Matrix<value_type> lower(_size, _size);
+    for (size_type r = 0; r < _size; ++r) {
+      for (size_type c = 0; c < r; ++c) lower(r, c) = _lu[r * _size + c];
+      lower(r, r) = value_type{1};
+    }
+    return lower;
+  }
+
+  S21Matrix<value_type> GetUpper() const {
+    S21Matrix<value_type> upper(_size, _size);
+    for (size_type r = 0; r < _size; ++r) {
+      for (size_type c = r; c < _size; ++c) upper(r, c) = _lu[r * _size + c];
+    }
+    return upper;
+  }
+
+  // row i of P * A is row GetPermutation()[i] of A
+  const std::vector<size_type>& GetPermutation() const noexcept {
+    return _perm;
+  }
+
+ private:
+  static constexpr double kEps = std::numeric_limits<double>::epsilon();
+
+  void CheckIsNonsingular() const {
+    if (_info.singular) {
+      throw std::logic_error("The matrix is singular.");
+    }
+  }
+
+  size_type _size;
+  std::vector<value_type> _lu;
+  std::vector<size_type> _perm;
+  detail::LuInfo _info{};
+};
+
+// A = L * L^T for a symmetric positive definite A; half the work of LU and
+// no pivoting. Only the lower triangle of A is read.
+template <typename T>
+class Cholesky {
+ public:
+  using size_type = std::size_t;
+  using value_type = detail::LuReal<T>;
+
+ public:
+  explicit Cholesky(const S21Matrix<T>& matrix)
+      : _size(matrix.GetRows()),
+        _lower(detail::ToBuffer<value_type>(matrix)) {
+    detail::CheckIsSquare("Cholesky", matrix.GetRows(), matrix.GetCols());
+    for (size_type i = 0; i < _size; ++i) {
+      value_type* li = _lower.data() + i * _size;
+      for (size_type j = 0; j <= i; ++j) {
+        const value_type* lj = _lower.data() + j * _size;
+        value_type sum = li[j];
+        for (size_type k = 0; k < j; ++k) sum -= li[k] * lj[k];
+        if (i == j) {
+          if (!(sum > 0)) {
+            throw std::logic_error("The matrix is not positive definite.");
+          }
+          li[i] = std::sqrt(sum);
+        } else {
+          li[j] = sum / lj[j];
+        }
+      }
+      std::fill(li + i + 1, li + _size, value_type{});
+    }
+  }
+
+  size_type GetSize() const noexcept { return _size; }
+
+  long double Determinant() const noexcept {
+    long double det = 1.0;
+    for (size_type i = 0; i < _size; ++i) det *= _lower[i * _size + i];
+    return det * det;
+  }
+
+  S21Matrix<T> Solve(const S21Matrix<T>& rhs) const {
+    detail::CheckRhsRows(_size, rhs.GetRows());
+    size_type nrhs = rhs.GetCols();
+    std::vector<value_type> x = detail::ToBuffer<value_type>(rhs);
+    const value_type* l = _lower.data();
+    s21::ParallelFor(
+        nrhs, _size * _size,
+        [&](size_type begin, size_type end) {
+          size_type width = end - begin;
+          // L * y = b
+          for (size_type i = 0; i < _size; ++i) {
+            value_type* xi = x.data() + i * nrhs + begin;
+            for (size_type k = 0; k < i; ++k) {
+              const value_type lik = l[i * _size + k];
+              const value_type* xk = x.data() + k * nrhs + begin;
+              for (size_type j = 0; j < width; ++j) xi[j] -= lik * xk[j];
+            }
+            const value_type diag = l[i * _size + i];
+            for (size_type j = 0; j < width; ++j) xi[j] /= diag;
+          }
+          // L^T * x = y
+          for (size_type i = _size; i-- > 0;) {
+            value_type* xi = x.data() + i * nrhs + begin;
+            for (size_type k = i + 1; k < _size; ++k) {
+              const value_type lki = l[k * _size + i];
+              const value_type* xk = x.data() + k * nrhs + begin;
+              for (size_type j = 0; j < width; ++j) xi[j] -= lki * xk[j];
+            }
+            const value_type diag = l[i * _size + i];
+            for (size_type j = 0; j < width; ++j) xi[j] /= diag;
+          }
+        },
+        64);
+    return detail::FromBuffer<T>(x.data(), _size, nrhs, nrhs);
+  }
+
+  S21Matrix<value_type> GetLower() const {
+    return detail::FromBuffer<value_type>(_lower.data(), _size, _size, _size);
+  }
+
+ private:
+  size_type _size;
+  std::vector<value_type> _lower;
+};
+
+// A = Q * R by Householder reflections for an m x n matrix with m >= n.
+// Solve returns the least-squares solution when m > n.
+template <typename T>
+class QR {
+ public:
+  using size_type = std::size_t;
+  using value_type = detail::LuReal<T>;
+
+ public:
+  explicit QR(const S21Matrix<T>& matrix)
+      : _rows(matrix.GetRows()),
+        _cols(matrix.GetCols()),
+        _qr(detail::ToBuffer<value_type>(matrix)),
+        _tau(_cols) {
+    if (_rows < _cols) {
+      throw std::logic_error(std::string("QR needs rows >= cols, got ") +
+                             detail::DimString(_rows, _cols));
+    }
+    std::vector<value_type> work(_cols);
+    for (size_type k = 0; k < _cols; ++k) {
+      // reflector zeroing A[k + 1:, k], stored below the diagonal
+      // with an implicit leading 1
+      value_type alpha = _qr[k * _cols + k];
+      value_type norm = 0;
+      for (size_type i = k + 1; i < _rows; ++i) {
+        norm += _qr[i * _cols + k] * _qr[i * _cols + k];
+      }
+      if (norm == 0) {
+        _tau[k] = 0;
+        continue;
+      }
+      value_type beta = std::sqrt(alpha * alpha + norm);
+      if (alpha > 0) beta = -beta;
+      _tau[k] = (beta - alpha) / beta;
+      value_type scale = 1 / (alpha - beta);
+      for (size_type i = k + 1; i < _rows; ++i) _qr[i * _cols + k] *= scale;
+      _qr[k * _cols + k] = beta;
+      ApplyReflector(k, _qr.data() + k + 1, _cols, _cols - k - 1,
+                     work.data());
+    }
+  }
+
+  size_type GetRows() const noexcept { return _rows; }
+  size_type GetCols() const noexcept { return _cols; }
+
+  // X minimising ||A * X - rhs|| column by column
+  S21Matrix<T> Solve(const S21Matrix<T>& rhs) const {
+    detail::CheckRhsRows(_rows, rhs.GetRows());
+    for (size_type k = 0; k < _cols; ++k) {
+      if (std::fabs(_qr[k * _cols + k]) < kEps) {
+        throw std::logic_error("The matrix is rank deficient.");
+      }
+    }
+    size_type nrhs = rhs.GetCols();
+    std::vector<value_type> x = detail::ToBuffer<value_type>(rhs);
+    s21::ParallelFor(
+        nrhs, _rows * _cols,
+        [&](size_type begin, size_type end) {
+          size_type width = end - begin;
+          std::vector<value_type> work(width);
+          // Q^T * b
+          for (size_type k = 0; k < _cols; ++k) {
+            ApplyReflector(k, x.data() + begin, nrhs, width, work.data());
+          }
+          // R * x = (Q^T * b)[:n]
+          for (size_type i = _cols; i-- > 0;) {
+            value_type* xi = x.data() + i * nrhs + begin;
+            for (size_type k = i + 1; k < _cols; ++k) {
+              const value_type rik = _qr[i * _cols + k];
+              const value_type* xk = x.data() + k * nrhs + begin;
+              for (size_type j = 0; j < width; ++j) xi[j] -= rik * xk[j];
+            }
+            const value_type diag = _qr[i * _cols + i];
+            for (size_type j = 0; j < width; ++j) xi[j] /= diag;
+          }
+        },
+        64);
+    return detail::FromBuffer<T>(x.data(), _cols, nrhs, nrhs);
+  }
+
+  // the n x n upper triangular factor
+  S21Matrix<value_type> GetR() const {
+    S21Matrix<value_type> r(_cols, _cols);
+    for (size_type i = 0; i < _cols; ++i) {
+      for (size_type j = i; j < _cols; ++j) r(i, j) = _qr[i * _cols + j];
+    }
+    return r;
+  }
+
+  // the m x n factor with orthonormal columns
+  S21Matrix<value_type> GetQ() const {
+    std::vector<value_type> q(_rows * _cols), work(_cols);
+    for (size_type i = 0; i < _cols; ++i) q[i * _cols + i] = 1;
+    for (size_type k = _cols; k-- > 0;) {
+      ApplyReflector(k, q.data(), _cols, _cols, work.data());
+    }
+    return detail::FromBuffer<value_type>(q.data(), _rows, _cols, _cols);
+  }
+
+ private:
+  static constexpr double kEps = std::numeric_limits<double>::epsilon();
+
+  // B[k:, :width] -= tau_k * v_k * (v_k^T * B[k:, :width]) for B with
+  // leading dimension ldb; rows are walked contiguously.
+  void ApplyReflector(size_type k, value_type* b, size_type ldb,
+                      size_type width, value_type* work) const {
+    if (_tau[k] == 0) return;
+    std::copy(b + k * ldb, b + k * ldb + width, work);
+    for (size_type i = k + 1; i < _rows; ++i) {
+      const value_type vi = _qr[i * _cols + k];
+      const value_type* bi = b + i * ldb;
+      for (size_type j = 0; j < width; ++j) work[j] += vi * bi[j];
+    }
+    for (size_type j = 0; j < width; ++j) work[j] *= _tau[k];
+    value_type* bk = b + k * ldb;
+    for (size_type j = 0; j < width; ++j) bk[j] -= work[j];
+    for (size_type i = k + 1; i < _rows; ++i) {
+      const value_type vi = _qr[i * _cols + k];
+      value_type* bi = b + i * ldb;
+      for (size_type j = 0; j < width; ++j) bi[j] -= vi * work[j];
+    }
+  }
+
+  size_type _rows, _cols;
+  std::vector<value_type> _qr;
+  std::vector<value_type> _tau;
+};
+
+}  // namespace s21
+
+#endif  // S21_MATRIXPLUSPLUS_SRC_S21_MATRIX_DECOMPOSITIONS_H_
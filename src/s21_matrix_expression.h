@@ -0,0 +1,173 @@
+#ifndef S21_MATRIXPLUSPLUS_SRC_S21_MATRIX_EXPRESSION_H_
+#define S21_MATRIXPLUSPLUS_SRC_S21_MATRIX_EXPRESSION_H_
+
+#include <cstddef>
+#include <memory_resource>
+#include <stdexcept>
+#include <string>
+#include <type_traits>
+
+#include "s21_matrix_traits.h"
+
+// Expression templates for the element-wise arithmetic of S21Matrix.
+// `a + b - c * 2.0` builds a tree of lightweight nodes holding references
+// to the operands; nothing is computed until the tree is assigned to an
+// S21Matrix, which then fills its buffer in one fused pass.
+// As with any expression template, do not keep a node (e.g. in `auto`)
+// beyond the lifetime of the matrices it refers to.
+namespace s21 {
+
+// CRTP base of everything that can be evaluated element by element:
+// E provides value_type, GetRows(), GetCols() and Eval(row, col), and
+// GetResource(), the memory resource a result of E is allocated from.
+template <typename E>
+class MatrixExpression {
+ public:
+  const E& Self() const noexcept { return static_cast<const E&>(*this); }
+
+ protected:
+  MatrixExpression() = default;
+  ~MatrixExpression() = default;
+};
+
+template <typename E>
+inline constexpr bool kIsMatrixExpression =
+    std::is_base_of_v<MatrixExpression<E>, E>;
+
+// true for S21MatrixView (s21_matrix_view.h)
+template <typename E>
+inline constexpr bool kIsMatrixView = false;
+
+namespace detail {
+
+// Matrices are held by reference; views and intermediate nodes are
+// cheap to copy and held by value.
+template <typename E>
+using ExpressionOperand =
+    std::conditional_t<E::kIsExpressionLeaf && !kIsMatrixView<E>, const E&,
+                       const E>;
+
+inline std::string DimString(std::size_t rows, std::size_t cols) {
+  return std::string("(") + std::to_string(rows) + ", " +
+         std::to_string(cols) + ")";
+}
+
+struct PlusOp {
+  template <typename T>
+  static T Apply(T lhs, T rhs) noexcept {
+    return static_cast<T>(lhs + rhs);
+  }
+};
+
+struct MinusOp {
+  template <typename T>
+  static T Apply(T lhs, T rhs) noexcept {
+    return static_cast<T>(lhs - rhs);
+  }
+};
+
+// Same rounding as S21Matrix::MulNumber: floating types multiply in their
+// own precision, integers through the long double factor.
+template <typename T>
+T ScaleValue(T value, long double factor) noexcept {
+  if constexpr (std::is_floating_point_v<T>) {
+    return value * static_cast<T>(factor);
+  } else {
+    return static_cast<T>(value * factor);
+  }
+}
+
+}  // namespace detail
+
+// Operands of different element types are promoted element by element,
+// so `a + b` of float and double matrices is an expression of double.
+template <typename L, typename R, typename Op>
+class BinaryExpression
+    : public MatrixExpression<BinaryExpression<L, R, Op>> {
+ public:
+  using value_type =
+      Promoted<typename L::value_type, typename R::value_type>;
+  using size_type = std::size_t;
+  static constexpr bool kIsExpressionLeaf = false;
+
+ public:
+  BinaryExpression(const L& lhs, const R& rhs) : _lhs(lhs), _rhs(rhs) {
+    if (lhs.GetRows() != rhs.GetRows() || lhs.GetCols() != rhs.GetCols()) {
+      throw std::logic_error(
+          std::string("Size mismatch: this ") +
+          detail::DimString(lhs.GetRows(), lhs.GetCols()) + " != other " +
+          detail::DimString(rhs.GetRows(), rhs.GetCols()));
+    }
+  }
+
+  size_type GetRows() const noexcept { return _lhs.GetRows(); }
+  size_type GetCols() const noexcept { return _lhs.GetCols(); }
+
+  std::pmr::memory_resource* GetResource() const noexcept {
+    return _lhs.GetResource();
+  }
+
+  value_type Eval(size_type row, size_type col) const noexcept {
+    return Op::Apply(static_cast<value_type>(_lhs.Eval(row, col)),
+                     static_cast<value_type>(_rhs.Eval(row, col)));
+  }
+
+ private:
+  detail::ExpressionOperand<L> _lhs;
+  detail::ExpressionOperand<R> _rhs;
+};
+
+template <typename E>
+class ScaleExpression : public MatrixExpression<ScaleExpression<E>> {
+ public:
+  using value_type = typename E::value_type;
+  using size_type = std::size_t;
+  static constexpr bool kIsExpressionLeaf = false;
+
+ public:
+  ScaleExpression(const E& expr, long double factor) noexcept
+      : _expr(expr), _factor(factor) {}
+
+  size_type GetRows() const noexcept { return _expr.GetRows(); }
+  size_type GetCols() const noexcept { return _expr.GetCols(); }
+
+  std::pmr::memory_resource* GetResource() const noexcept {
+    return _expr.GetResource();
+  }
+
+  value_type Eval(size_type row, size_type col) const noexcept {
+    return detail::ScaleValue(_expr.Eval(row, col), _factor);
+  }
+
+ private:
+  detail::ExpressionOperand<E> _expr;
+  long double _factor;
+};
+
+template <typename L, typename R>
+BinaryExpression<L, R, detail::PlusOp> operator+(
+    const MatrixExpression<L>& lhs, const MatrixExpression<R>& rhs) {
+  return {lhs.Self(), rhs.Self()};
+}
+
+template <typename L, typename R>
+BinaryExpression<L, R, detail::MinusOp> operator-(
+    const MatrixExpression<L>& lhs, const MatrixExpression<R>& rhs) {
+  return {lhs.Self(), rhs.Self()};
+}
+
+template <typename E>
+ScaleExpression<E> operator*(const MatrixExpression<E>& expr,
+                             long double factor) noexcept {
+  return {expr.Self(), factor};
+}
+
+template <typename E>
+ScaleExpression<E> operator*(long double factor,
+                             const MatrixExpression<E>& expr) noexcept {
+  return {expr.Self(), factor};
+}
+
+}  // namespace s21
+
+#endif  // S21_MATRIXPLUSPLUS_SRC_S21_MATRIX_EXPRESSION_H_
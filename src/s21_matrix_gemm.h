@@ -0,0 +1,260 @@
+#ifndef S21_MATRIXPLUSPLUS_SRC_S21_MATRIX_GEMM_H_
+#define S21_MATRIXPLUSPLUS_SRC_S21_MATRIX_GEMM_H_
+
+#include <algorithm>
+#include <cstddef>
+#include <cstring>
+#include <type_traits>
+#include <vector>
+
+#include "s21_matrix_thread_pool.h"
+
+namespace s21 {
+namespace detail {
+
+// float and double get a micro-kernel written with GCC/Clang vector
+// extensions: left to the auto-vectoriser, a fully unrolled register tile
+// is frequently scalarised.
+#if defined(__GNUC__)
+template <typename T>
+inline constexpr bool kHasVectorKernel =
+    std::is_same_v<T, float> || std::is_same_v<T, double>;
+#else
+template <typename T>
+inline constexpr bool kHasVectorKernel = false;
+#endif
+
+// Blocking of the packed GEMM (the classic Goto/BLIS loop nest):
+// a KC x NC panel of B is packed once and stays in L2/L3,
+// an MC x KC block of A is packed into L2,
+// and an MR x NR tile of C is accumulated in registers.
+template <typename T>
+struct GemmBlocking {
+  // width of one vector register of the vector kernel, in bytes
+  static constexpr std::size_t kVectorBytes = 32;
+  static constexpr std::size_t kMR = kHasVectorKernel<T> ? 6 : 4;
+  static constexpr std::size_t kNR =
+      kHasVectorKernel<T>
+          ? 2 * kVectorBytes / sizeof(T)
+          : std::min<std::size_t>(16,
+                                  std::max<std::size_t>(4, 64 / sizeof(T)));
+  static constexpr std::size_t kKC = 256;
+  static constexpr std::size_t kMC = 120;
+  static constexpr std::size_t kNC = 4096;
+  // below this amount of multiply-adds packing does not pay off
+  static constexpr std::size_t kSmall = 32 * 32 * 32;
+};
+
+inline std::size_t RoundUp(std::size_t value, std::size_t step) noexcept {
+  return (value + step - 1) / step * step;
+}
+
+// Packs an mc x kc block of A into MR-row panels, column by column,
+// converting the elements to the accumulator type T on the way.
+// Rows past mc are zero-filled so the micro-kernel never branches.
+template <typename S, typename T>
+void PackA(const S* a, std::size_t lda, std::size_t mc, std::size_t kc,
+           T* dst) noexcept {
+  constexpr std::size_t kMR = GemmBlocking<T>::kMR;
+  for (std::size_t i0 = 0; i0 < mc; i0 += kMR) {
+    std::size_t mr = std::min(kMR, mc - i0);
+    for (std::size_t p = 0; p < kc; ++p) {
+      for (std::size_t i = 0; i < mr; ++i) {
+        dst[i] = static_cast<T>(a[(i0 + i) * lda + p]);
+      }
+      for (std::size_t i = mr; i < kMR; ++i) dst[i] = T{};
+      dst += kMR;
+    }
+  }
+}
+
+// Packs a kc x nc panel of B into NR-column slivers, row by row.
+template <typename S, typename T>
+void PackB(const S* b, std::size_t ldb, std::size_t kc, std::size_t nc,
+           T* dst) noexcept {
+  constexpr std::size_t kNR = GemmBlocking<T>::kNR;
+  for (std::size_t j0 = 0; j0 < nc; j0 += kNR) {
+    std::size_t nr = std::min(kNR, nc - j0);
+    for (std::size_t p = 0; p < kc; ++p) {
+      const S* src = b + p * ldb + j0;
+      for (std::size_t j = 0; j < nr; ++j) dst[j] = static_cast<T>(src[j]);
+      for (std::size_t j = nr; j < kNR; ++j) dst[j] = T{};
+      dst += kNR;
+    }
+  }
+}
+
+// C[mr x nr] += Apanel * Bsliver; the full MR x NR tile is computed
+// in a local accumulator and only the valid part is stored back.
+template <typename T>
+void MicroKernel(std::size_t kc, const T* a, const T* b, T* c,
+                 std::size_t ldc, std::size_t mr, std::size_t nr) noexcept {
+  constexpr std::size_t kMR = GemmBlocking<T>::kMR;
+  constexpr std::size_t kNR = GemmBlocking<T>::kNR;
+  T acc[kMR][kNR] = {};
+#if defined(__GNUC__)
+  if constexpr (kHasVectorKernel<T>) {
+    typedef T Vec __attribute__((vector_size(GemmBlocking<T>::kVectorBytes)));
+    constexpr std::size_t kVecs = kNR * sizeof(T) / sizeof(Vec);
+    Vec vacc[kMR][kVecs] = {};
+    for (std::size_t p = 0; p < kc; ++p) {
+      Vec bv[kVecs];
+      std::memcpy(bv, b, sizeof(bv));
+      for (std::size_t i = 0; i < kMR; ++i) {
+        const T ai = a[i];
+        for (std::size_t v = 0; v < kVecs; ++v) vacc[i][v] += ai * bv[v];
+      }
+      a += kMR;
+      b += kNR;
+    }
+    std::memcpy(acc, vacc, sizeof(acc));
+  } else
+#endif
+  {
+    for (std::size_t p = 0; p < kc; ++p) {
+      for (std::size_t i = 0; i < kMR; ++i) {
+        const T ai = a[i];
+        for (std::size_t j = 0; j < kNR; ++j) acc[i][j] += ai * b[j];
+      }
+      a += kMR;
+      b += kNR;
+    }
+  }
+  for (std::size_t i = 0; i < mr; ++i) {
+    for (std::size_t j = 0; j < nr; ++j) c[i * ldc + j] += acc[i][j];
+  }
+}
+
+// Unpacked i-k-j loop for operands too small to amortise packing.
+template <typename S, typename T>
+void GemmSmall(std::size_t m, std::size_t n, std::size_t k, const S* a,
+               std::size_t lda, const S* b, std::size_t ldb, T* c,
+               std::size_t ldc) noexcept {
+  for (std::size_t i = 0; i < m; ++i) {
+    T* crow = c + i * ldc;
+    for (std::size_t p = 0; p < k; ++p) {
+      const T aip = static_cast<T>(a[i * lda + p]);
+      const S* brow = b + p * ldb;
+      for (std::size_t j = 0; j < n; ++j) {
+        crow[j] += aip * static_cast<T>(brow[j]);
+      }
+    }
+  }
+}
+
+// The packed loop nest; every C element sees the same sequence of
+// KC-block updates whatever rows it is called for.
+template <typename S, typename T>
+void GemmPacked(std::size_t m, std::size_t n, std::size_t k, const S* a,
+                std::size_t lda, const S* b, std::size_t ldb, T* c,
+                std::size_t ldc) {
+  using Blk = GemmBlocking<T>;
+  std::size_t kc_max = std::min(k, Blk::kKC);
+  std::vector<T> apack(RoundUp(std::min(m, Blk::kMC), Blk::kMR) * kc_max);
+  std::vector<T> bpack(kc_max * RoundUp(std::min(n, Blk::kNC), Blk::kNR));
+  for (std::size_t jc = 0; jc < n; jc += Blk::kNC) {
+    std::size_t nc = std::min(Blk::kNC, n - jc);
+    for (std::size_t pc = 0; pc < k; pc += Blk::kKC) {
+      std::size_t kc = std::min(Blk::kKC, k - pc);
+      PackB(b + pc * ldb + jc, ldb, kc, nc, bpack.data());
+      for (std::size_t ic = 0; ic < m; ic += Blk::kMC) {
+        std::size_t mc = std::min(Blk::kMC, m - ic);
+        PackA(a + ic * lda + pc, lda, mc, kc, apack.data());
+        for (std::size_t jr = 0; jr < nc; jr += Blk::kNR) {
+          for (std::size_t ir = 0; ir < mc; ir += Blk::kMR) {
+            MicroKernel(kc, apack.data() + ir * kc, bpack.data() + jr * kc,
+                        c + (ic + ir) * ldc + jc + jr, ldc,
+                        std::min(Blk::kMR, mc - ir),
+                        std::min(Blk::kNR, nc - jr));
+          }
+        }
+      }
+    }
+  }
+}
+
+// The packed product with rows of C split across threads in whole MC
+// blocks, each thread packing its own copy of B.
+template <typename S, typename T>
+void GemmParallel(std::size_t m, std::size_t n, std::size_t k, const S* a,
+                  std::size_t lda, const S* b, std::size_t ldb, T* c,
+                  std::size_t ldc) {
+  s21::ParallelFor(
+      m, n * k,
+      [&](std::size_t begin, std::size_t end) {
+        GemmPacked(end - begin, n, k, a + begin * lda, lda, b, ldb,
+                   c + begin * ldc, ldc);
+      },
+      GemmBlocking<T>::kMC);
+}
+
+// C[m x n] += A[m x k] * B[k x n] for row-major operands with leading
+// dimensions lda, ldb and ldc. The products are accumulated in the element
+// type T of C, so A and B of float may be multiplied into a C of double.
+template <typename S, typename T>
+void Gemm(std::size_t m, std::size_t n, std::size_t k, const S* a,
+          std::size_t lda, const S* b, std::size_t ldb, T* c,
+          std::size_t ldc) {
+  if (!m || !n || !k) return;
+  if (m * n * k <= GemmBlocking<T>::kSmall) {
+    GemmSmall(m, n, k, a, lda, b, ldb, c, ldc);
+    return;
+  }
+  GemmParallel(m, n, k, a, lda, b, ldb, c, ldc);
+}
+
+// C = A * B written over A itself, for a square B (k == n). Rows of C are
+// computed a block at a time into scratch and copied over the rows of A
+// they came from, which are not read again. Each element is summed
+// exactly as by Gemm into a zeroed C.
+template <typename T>
+void GemmOverLhs(std::size_t m, std::size_t n, T* a, std::size_t lda,
+                 const T* b, std::size_t ldb) {
+  using Blk = GemmBlocking<T>;
+  if (!m || !n) return;
+  bool small = m * n * n <= Blk::kSmall;
+  std::size_t block = small ? m : std::min(m, 8 * Blk::kMC);
+  std::vector<T> scratch(block * n);
+  for (std::size_t i0 = 0; i0 < m; i0 += block) {
+    std::size_t rows = std::min(block, m - i0);
+    std::fill_n(scratch.data(), rows * n, T{});
+    if (small) {
+      GemmSmall(rows, n, n, a + i0 * lda, lda, b, ldb, scratch.data(), n);
+    } else {
+      GemmParallel(rows, n, n, a + i0 * lda, lda, b, ldb, scratch.data(), n);
+    }
+    for (std::size_t r = 0; r < rows; ++r) {
+      std::copy_n(scratch.data() + r * n, n, a + (i0 + r) * lda);
+    }
+  }
+}
+
+// C = A * B written over B itself, for a square A (m == k), a block of
+// columns at a time. The blocks are whole multiples of the register tile
+// within one NC panel, so the sums are again the same as Gemm's.
+template <typename T>
+void GemmOverRhs(std::size_t m, std::size_t n, const T* a, std::size_t lda,
+                 T* b, std::size_t ldb) {
+  using Blk = GemmBlocking<T>;
+  if (!m || !n) return;
+  bool small = m * n * m <= Blk::kSmall;
+  std::size_t block = small ? n : std::min(n, 32 * Blk::kNR);
+  std::vector<T> scratch(m * block);
+  for (std::size_t j0 = 0; j0 < n; j0 += block) {
+    std::size_t cols = std::min(block, n - j0);
+    std::fill_n(scratch.data(), m * cols, T{});
+    if (small) {
+      GemmSmall(m, cols, m, a, lda, b, ldb, scratch.data(), cols);
+    } else {
+      GemmParallel(m, cols, m, a, lda, b + j0, ldb, scratch.data(), cols);
+    }
+    for (std::size_t r = 0; r < m; ++r) {
+      std::copy_n(scratch.data() + r * cols, cols, b + r * ldb + j0);
+    }
+  }
+}
+
+}  // namespace detail
+}  // namespace s21
+
+#endif  // S21_MATRIXPLUSPLUS_SRC_S21_MATRIX_GEMM_H_
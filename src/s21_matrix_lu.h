@@ -0,0 +1,121 @@
+#ifndef S21_MATRIXPLUSPLUS_SRC_S21_MATRIX_LU_H_
+#define S21_MATRIXPLUSPLUS_SRC_S21_MATRIX_LU_H_
+
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <type_traits>
+
+#include "s21_matrix_thread_pool.h"
+
+// LU factorisation with partial pivoting on raw row-major buffers.
+// S21Matrix uses it for Determinant, InverseMatrix and CalcComplements;
+// s21::LU (s21_matrix_decompositions.h) wraps it as a reusable object.
+namespace s21 {
+namespace detail {
+
+// Integer matrices are factored in double, floating ones in their own type.
+template <typename T>
+using LuReal = std::conditional_t<std::is_floating_point_v<T>, T, double>;
+
+struct LuInfo {
+  bool singular;
+  int sign;  // parity of the row permutation
+};
+
+// Factors the n x n matrix `a` in place into P * A = L * U: U is stored on
+// and above the diagonal, the unit lower L below it, and perm[i] is the
+// original index of row i. A column whose pivot is below eps in magnitude
+// is left as is and marks the matrix singular.
+template <typename W>
+LuInfo LuFactor(W* a, std::size_t n, std::size_t lda, std::size_t* perm,
+                double eps) {
+  LuInfo info{false, 1};
+  for (std::size_t i = 0; i < n; ++i) perm[i] = i;
+  for (std::size_t k = 0; k < n; ++k) {
+    std::size_t pivot = k;
+    for (std::size_t i = k + 1; i < n; ++i) {
+      if (std::abs(a[i * lda + k]) > std::abs(a[pivot * lda + k])) pivot = i;
+    }
+    if (std::abs(a[pivot * lda + k]) < eps) {
+      info.singular = true;
+      continue;
+    }
+    if (pivot != k) {
+      std::swap_ranges(a + k * lda, a + k * lda + n, a + pivot * lda);
+      std::swap(perm[k], perm[pivot]);
+      info.sign = -info.sign;
+    }
+    const W* urow = a + k * lda;
+    const W diag = urow[k];
+    std::size_t rest = n - k - 1;
+    s21::ParallelFor(rest, rest, [&](std::size_t begin, std::size_t end) {
+      for (std::size_t i = k + 1 + begin; i < k + 1 + end; ++i) {
+        W* row = a + i * lda;
+        const W factor = row[k] / diag;
+        row[k] = factor;
+        for (std::size_t j = k + 1; j < n; ++j) row[j] -= factor * urow[j];
+      }
+    });
+  }
+  return info;
+}
+
+// Product of the U diagonal with the permutation sign.
+template <typename W>
+long double LuDeterminant(const W* lu, std::size_t n, std::size_t lda,
+                          const LuInfo& info) noexcept {
+  if (info.singular) return 0.0;
+  long double det = info.sign;
+  for (std::size_t k = 0; k < n; ++k) det *= lu[k * lda + k];
+  return det;
+}
+
+// Solves A * X = B for a nonsingular factored A, where `b` holds the
+// n x nrhs right-hand sides already permuted by P and is overwritten
+// with X. Substitution runs on whole rows of B, and column blocks of B
+// are independent, so they are spread across threads.
+template <typename W>
+void LuSolveInPlace(const W* lu, std::size_t n, std::size_t lda, W* b,
+                    std::size_t nrhs, std::size_t ldb) {
+  s21::ParallelFor(
+      nrhs, n * n,
+      [&](std::size_t begin, std::size_t end) {
+        std::size_t width = end - begin;
+        for (std::size_t i = 0; i < n; ++i) {
+          W* bi = b + i * ldb + begin;
+          for (std::size_t k = 0; k < i; ++k) {
+            const W lik = lu[i * lda + k];
+            const W* bk = b + k * ldb + begin;
+            for (std::size_t j = 0; j < width; ++j) bi[j] -= lik * bk[j];
+          }
+        }
+        for (std::size_t i = n; i-- > 0;) {
+          W* bi = b + i * ldb + begin;
+          for (std::size_t k = i + 1; k < n; ++k) {
+            const W uik = lu[i * lda + k];
+            const W* bk = b + k * ldb + begin;
+            for (std::size_t j = 0; j < width; ++j) bi[j] -= uik * bk[j];
+          }
+          const W diag = lu[i * lda + i];
+          for (std::size_t j = 0; j < width; ++j) bi[j] /= diag;
+        }
+      },
+      64);
+}
+
+// Writes A^-1 (n x n, leading dimension ldx) for a nonsingular factored A.
+template <typename W>
+void LuInverse(const W* lu, std::size_t n, std::size_t lda,
+               const std::size_t* perm, W* x, std::size_t ldx) {
+  for (std::size_t i = 0; i < n; ++i) {
+    std::fill(x + i * ldx, x + i * ldx + n, W{});
+    x[i * ldx + perm[i]] = W{1};
+  }
+  LuSolveInPlace(lu, n, lda, x, n, ldx);
+}
+
+}  // namespace detail
+}  // namespace s21
+
+#endif  // S21_MATRIXPLUSPLUS_SRC_S21_MATRIX_LU_H_
@@ -0,0 +1,229 @@
+#ifndef S21_MATRIXPLUSPLUS_SRC_S21_MATRIX_MEMORY_H_
+#define S21_MATRIXPLUSPLUS_SRC_S21_MATRIX_MEMORY_H_
+
+#include <algorithm>
+#include <cstddef>
+#include <memory_resource>
+#include <new>
+
+// Memory resources for S21Matrix storage. Matrices allocate through a
+// std::pmr::memory_resource (the default one unless told otherwise), so
+// any standard or custom resource plugs in; the two below are tuned for
+// the common cases of many short-lived small matrices.
+// Like std::pmr::unsynchronized_pool_resource, neither is thread-safe:
+// use one per thread, and keep a resource alive while its matrices are.
+namespace s21 {
+
+// Segregated free lists for power-of-two size classes from kMinBlock to
+// kMaxBlock bytes: a freed block goes to the front of its class list and
+// is handed out again by the next allocation of that class, so steady
+// creation and destruction of small matrices never reaches the upstream
+// resource. Blocks are carved from kChunkBytes chunks, which are only
+// returned upstream by Release() or the destructor. Larger requests go
+// straight upstream.
+class PoolResource : public std::pmr::memory_resource {
+ public:
+  using size_type = std::size_t;
+
+  static constexpr size_type kMinBlock = 16;
+  static constexpr size_type kMaxBlock = 4096;
+  static constexpr size_type kChunkBytes = 64 * 1024;
+
+ public:
+  explicit PoolResource(
+      std::pmr::memory_resource* upstream =
+          std::pmr::get_default_resource()) noexcept
+      : _upstream(upstream) {}
+
+  PoolResource(const PoolResource&) = delete;
+  PoolResource& operator=(const PoolResource&) = delete;
+
+  ~PoolResource() override { Release(); }
+
+  std::pmr::memory_resource* GetUpstream() const noexcept { return _upstream; }
+
+  // Returns every chunk upstream. Blocks still in use become dangling.
+  void Release() noexcept {
+    while (_chunks) {
+      Chunk* next = _chunks->next;
+      _upstream->deallocate(_chunks, kChunkBytes, kChunkAlign);
+      _chunks = next;
+    }
+    std::fill(std::begin(_free), std::end(_free), nullptr);
+  }
+
+ protected:
+  void* do_allocate(size_type bytes, size_type alignment) override {
+    if (!IsPooled(bytes, alignment)) {
+      return _upstream->allocate(bytes, alignment);
+    }
+    size_type index = ClassIndex(bytes, alignment);
+    if (!_free[index]) Refill(index);
+    FreeBlock* block = _free[index];
+    _free[index] = block->next;
+    return block;
+  }
+
+  void do_deallocate(void* ptr, size_type bytes,
+                     size_type alignment) override {
+    if (!IsPooled(bytes, alignment)) {
+      _upstream->deallocate(ptr, bytes, alignment);
+      return;
+    }
+    size_type index = ClassIndex(bytes, alignment);
+    _free[index] = new (ptr) FreeBlock{_free[index]};
+  }
+
+  bool do_is_equal(
+      const std::pmr::memory_resource& other) const noexcept override {
+    return this == &other;
+  }
+
+ private:
+  struct FreeBlock {
+    FreeBlock* next;
+  };
+
+  // the header keeps the blocks after it aligned to kChunkAlign
+  struct alignas(64) Chunk {
+    Chunk* next;
+  };
+
+  static constexpr size_type kChunkAlign = alignof(Chunk);
+  static constexpr size_type kClasses = 9;  // 16 .. 4096
+
+  static_assert(kMinBlock << (kClasses - 1) == kMaxBlock);
+
+  // a block of class size s is aligned to min(s, kChunkAlign)
+  static bool IsPooled(size_type bytes, size_type alignment) noexcept {
+    return bytes <= kMaxBlock && alignment <= kChunkAlign;
+  }
+
+  static size_type ClassIndex(size_type bytes, size_type alignment) noexcept {
+    size_type need = std::max({bytes, alignment, kMinBlock});
+    size_type index = 0;
+    while ((kMinBlock << index) < need) ++index;
+    return index;
+  }
+
+  void Refill(size_type index) {
+    void* memory = _upstream->allocate(kChunkBytes, kChunkAlign);
+    _chunks = new (memory) Chunk{_chunks};
+    size_type block = kMinBlock << index;
+    char* begin = static_cast<char*>(memory) + sizeof(Chunk);
+    char* end = static_cast<char*>(memory) + kChunkBytes;
+    // the list is built backwards so blocks are handed out in address order
+    for (size_type count = (end - begin) / block; count-- > 0;) {
+      _free[index] = new (begin + count * block) FreeBlock{_free[index]};
+    }
+  }
+
+  std::pmr::memory_resource* _upstream;
+  Chunk* _chunks{nullptr};
+  FreeBlock* _free[kClasses]{};
+};
+
+// A bump allocator for request-scoped matrices: allocation advances a
+// pointer through the current block, deallocation does nothing, and
+// Reset() frees everything at once. Blocks grow geometrically from
+// `initial_bytes`; Reset() keeps the largest one for the next request,
+// so a steady workload stops calling the upstream resource at all.
+class ArenaResource : public std::pmr::memory_resource {
+ public:
+  using size_type = std::size_t;
+
+ public:
+  explicit ArenaResource(size_type initial_bytes = 64 * 1024,
+                         std::pmr::memory_resource* upstream =
+                             std::pmr::get_default_resource()) noexcept
+      : _upstream(upstream),
+        _next_bytes(std::max(initial_bytes, sizeof(Block) * 2)) {}
+
+  ArenaResource(const ArenaResource&) = delete;
+  ArenaResource& operator=(const ArenaResource&) = delete;
+
+  ~ArenaResource() override { Release(); }
+
+  std::pmr::memory_resource* GetUpstream() const noexcept { return _upstream; }
+
+  // bytes handed out since the last Reset() or Release()
+  size_type GetUsed() const noexcept { return _used; }
+
+  // Frees every allocation but keeps the current block.
+  void Reset() noexcept {
+    if (!_blocks) return;
+    ReleaseBlocks(_blocks->next);
+    _blocks->next = nullptr;
+    _cursor = reinterpret_cast<char*>(_blocks + 1);
+    _used = 0;
+  }
+
+  // Frees every allocation and returns all blocks upstream.
+  void Release() noexcept {
+    ReleaseBlocks(_blocks);
+    _blocks = nullptr;
+    _cursor = _end = nullptr;
+    _used = 0;
+  }
+
+ protected:
+  void* do_allocate(size_type bytes, size_type alignment) override {
+    void* ptr = Bump(bytes, alignment);
+    if (!ptr) {
+      Grow(bytes + alignment);
+      ptr = Bump(bytes, alignment);
+    }
+    _used += bytes;
+    return ptr;
+  }
+
+  void do_deallocate(void*, size_type, size_type) noexcept override {}
+
+  bool do_is_equal(
+      const std::pmr::memory_resource& other) const noexcept override {
+    return this == &other;
+  }
+
+ private:
+  struct alignas(std::max_align_t) Block {
+    Block* next;
+    size_type bytes;
+  };
+
+  void* Bump(size_type bytes, size_type alignment) noexcept {
+    void* ptr = _cursor;
+    size_type space = _end - _cursor;
+    if (!_cursor || !std::align(alignment, bytes, ptr, space)) return nullptr;
+    _cursor = static_cast<char*>(ptr) + bytes;
+    return ptr;
+  }
+
+  void Grow(size_type at_least) {
+    size_type bytes = _next_bytes;
+    while (bytes - sizeof(Block) < at_least) bytes *= 2;
+    void* memory = _upstream->allocate(bytes, alignof(Block));
+    _blocks = new (memory) Block{_blocks, bytes};
+    _cursor = reinterpret_cast<char*>(_blocks + 1);
+    _end = static_cast<char*>(memory) + bytes;
+    _next_bytes = bytes * 2;
+  }
+
+  void ReleaseBlocks(Block* block) noexcept {
+    while (block) {
+      Block* next = block->next;
+      _upstream->deallocate(block, block->bytes, alignof(Block));
+      block = next;
+    }
+  }
+
+  std::pmr::memory_resource* _upstream;
+  size_type _next_bytes;
+  Block* _blocks{nullptr};
+  char* _cursor{nullptr};
+  char* _end{nullptr};
+  size_type _used{0};
+};
+
+}  // namespace s21
+
+#endif  // S21_MATRIXPLUSPLUS_SRC_S21_MATRIX_MEMORY_H_
@@ -1,60 +1,171 @@
 #ifndef S21_MATRIXPLUSPLUS_SRC_S21_MATRIX_H_
 #define S21_MATRIXPLUSPLUS_SRC_S21_MATRIX_H_
 
+#include <algorithm>
+#include <cassert>
 #include <cmath>
+#include <cstring>
+#include <functional>
 #include <iostream>
+#include <limits>
+#include <memory>
+#include <memory_resource>
+#include <new>
 #include <stdexcept>
 #include <string>
 #include <tuple>
+#include <utility>
+#include <vector>
+
+#include "s21_matrix_expression.h"
+#include "s21_matrix_gemm.h"
+#include "s21_matrix_lu.h"
+#include "s21_matrix_memory.h"
+#include "s21_matrix_simd.h"
+#include "s21_matrix_stats.h"
+#include "s21_matrix_thread_pool.h"
+#include "s21_matrix_transpose.h"
+#include "s21_matrix_view.h"
 
 // https://stackoverflow.com/questions/14294267/class-template-for-numeric-types
-template <typename T,
-          typename =
-              typename std::enable_if<std::is_arithmetic<T>::value, T>::type>
-class S21Matrix {
+// the default argument is on the declaration in s21_matrix_view.h
+template <typename T, typename>
+class S21Matrix : public s21::MatrixExpression<S21Matrix<T>> {
  public:
+  using value_type = T;
   using size_type = std::size_t;
+  using allocator_type = std::pmr::polymorphic_allocator<T>;
+  using view_type = S21MatrixView<T>;
+  using const_view_type = S21MatrixView<const T>;
+  static constexpr bool kIsExpressionLeaf = true;
+
+  // enables the overloads taking a view_type or a const_view_type
+  template <typename V>
+  using EnableIfView = std::enable_if_t<
+      s21::kIsMatrixView<V> && std::is_same_v<typename V::value_type, T>>;
+
+  // enables the converting constructors from another element type
+  template <typename E>
+  using EnableIfConversion =
+      std::enable_if_t<!std::is_same_v<typename E::value_type, T>, int>;
 
  public:
-  S21Matrix() noexcept : _rows(0), _cols(0), _matrix(nullptr) {}
+  S21Matrix() noexcept : S21Matrix(allocator_type{}) {}
+
+  // an empty matrix whose storage will come from `alloc`
+  explicit S21Matrix(const allocator_type& alloc) noexcept
+      : _rows(0),
+        _cols(0),
+        _stride(0),
+        _capacity(0),
+        _matrix(nullptr),
+        _resource(alloc.resource()) {}
 
-  explicit S21Matrix(size_type rows, size_type cols) : S21Matrix() {
+  explicit S21Matrix(size_type rows, size_type cols,
+                     const allocator_type& alloc = {})
+      : S21Matrix(alloc) {
     if (!(!rows && !cols)) {
-      _matrix = new T[rows * cols]{};  // default value
+      size_type size = StorageSizeFor(rows, cols);
+      _stride = StrideFor(cols);
+      _matrix = Allocate(size);  // default value
+      _capacity = CapacityOf(_matrix, size);
       _rows = rows;
       _cols = cols;
     }
   }
 
-  explicit S21Matrix(size_type rows, size_type cols, T value)
-      : S21Matrix(rows, cols) {
-    std::fill(_matrix, _matrix + (rows * cols), value);
+  explicit S21Matrix(size_type rows, size_type cols, T value,
+                     const allocator_type& alloc = {})
+      : S21Matrix(rows, cols, alloc) {
+    for (size_type r = 0; r < rows; ++r) {
+      std::fill_n(_matrix + r * _stride, cols, value);
+    }
+  }
+
+  // a copy shares the memory resource of the original
+  S21Matrix(const S21Matrix& other) : S21Matrix(other, other.GetAllocator()) {}
+
+  S21Matrix(const S21Matrix& other, const allocator_type& alloc)
+      : S21Matrix(other._rows, other._cols, alloc) {
+    S21_MATRIX_STATS_COUNT(CountCopy());
+    std::copy_n(other._matrix, StorageSize(), _matrix);
   }
 
-  S21Matrix(const S21Matrix& other) : S21Matrix(other._rows, other._cols) {
-    std::copy(other._matrix, other._matrix + (_rows * _cols), _matrix);
+  // evaluates an expression such as `a + b - c * 2.0` in one pass,
+  // allocating from the resource of its leftmost matrix
+  template <typename E, typename = std::enable_if_t<
+                            std::is_same_v<typename E::value_type, T>>>
+  S21Matrix(const s21::MatrixExpression<E>& expr)
+      : S21Matrix(expr, allocator_type(expr.Self().GetResource())) {}
+
+  template <typename E, typename = std::enable_if_t<
+                            std::is_same_v<typename E::value_type, T>>>
+  S21Matrix(const s21::MatrixExpression<E>& expr, const allocator_type& alloc)
+      : S21Matrix(expr.Self().GetRows(), expr.Self().GetCols(), alloc) {
+    Assign(expr.Self());
   }
 
+  // Converts a matrix, view or expression of another element type,
+  // element by element with static_cast. Explicit, since it may narrow.
+  template <typename E, EnableIfConversion<E> = 0>
+  explicit S21Matrix(const s21::MatrixExpression<E>& expr)
+      : S21Matrix(expr, allocator_type(expr.Self().GetResource())) {}
+
+  template <typename E, EnableIfConversion<E> = 0>
+  explicit S21Matrix(const s21::MatrixExpression<E>& expr,
+                     const allocator_type& alloc)
+      : S21Matrix(expr.Self().GetRows(), expr.Self().GetCols(), alloc) {
+    Assign(expr.Self());
+  }
+
+  // an inline (small) matrix is copied, a heap one hands its buffer over
   S21Matrix(S21Matrix&& other) noexcept
-      : _rows(other._rows), _cols(other._cols), _matrix(other._matrix) {
+      : _rows(other._rows),
+        _cols(other._cols),
+        _stride(other._stride),
+        _capacity(other._capacity),
+        _matrix(other._matrix),
+        _resource(other._resource) {
+    S21_MATRIX_STATS_COUNT(CountMove());
+    if (other.IsInline()) {
+      std::copy_n(other._inline, StorageSize(), _inline);
+      _matrix = _inline;
+    }
     other._matrix = nullptr;
     other._rows = 0;
     other._cols = 0;
+    other._stride = 0;
+    other._capacity = 0;
   }
 
+  // the copy is placed in this matrix's own resource
   S21Matrix& operator=(const S21Matrix& other) {
     if (this != &other) {
-      S21Matrix copy{other};
-      *this = std::move(copy);
+      S21Matrix copy(other, GetAllocator());
+      Swap(copy);
     }
     return *this;
   }
 
+  // the buffer and the resource it came from travel together
   S21Matrix& operator=(S21Matrix&& other) noexcept {
     if (this != &other) {
-      std::swap(_rows, other._rows);
-      std::swap(_cols, other._cols);
-      std::swap(_matrix, other._matrix);
+      S21_MATRIX_STATS_COUNT(CountMove());
+      Swap(other);
+    }
+    return *this;
+  }
+
+  // Expression nodes only read the element they produce,
+  // so `a = a + b` is evaluated in place without a temporary.
+  template <typename E, typename = std::enable_if_t<
+                            std::is_same_v<typename E::value_type, T>>>
+  S21Matrix& operator=(const s21::MatrixExpression<E>& expr) {
+    const E& self = expr.Self();
+    if (_rows == self.GetRows() && _cols == self.GetCols() && _matrix) {
+      Assign(self);
+    } else {
+      *this = S21Matrix(expr, GetAllocator());
     }
     return *this;
   }
@@ -63,76 +174,124 @@ class S21Matrix {
 
   // main operations
 
-  bool EqMatrix(const S21Matrix& other) const noexcept {
-    if (!IsEqualSize(other)) return false;
-    for (size_type i = 0; i < _rows * _cols; ++i) {
-      if (std::fabs(_matrix[i] - other._matrix[i]) > _eps) {
-        return false;
-      }
-    }
-    return true;
+  bool EqMatrix(const S21Matrix& other) const {
+    return EqMatrix(other, s21::DefaultTolerance<value_type>());
+  }
+
+  template <typename V, typename = EnableIfView<V>>
+  bool EqMatrix(const V& other) const {
+    return EqMatrix(other, s21::DefaultTolerance<value_type>());
+  }
+
+  // element by element within `tolerance` (s21_matrix_tolerance.h)
+  template <typename Tolerance, typename = s21::EnableIfTolerance<Tolerance>>
+  bool EqMatrix(const S21Matrix& other, const Tolerance& tolerance) const {
+    return View().EqMatrix(other.View(), tolerance);
+  }
+
+  template <typename V, typename Tolerance, typename = EnableIfView<V>,
+            typename = s21::EnableIfTolerance<Tolerance>>
+  bool EqMatrix(const V& other, const Tolerance& tolerance) const {
+    return View().EqMatrix(other, tolerance);
   }
 
   void SumMatrix(const S21Matrix& other) {
+    S21_MATRIX_STATS_SCOPE(s21::Operation::kSum, _rows * _cols);
     CheckIsEqualSize(other);
-    for (size_type i = 0; i < _rows * _cols; ++i) {
-      _matrix[i] += other._matrix[i];
-    }
+    const auto& kernels = s21::simd::Kernels<T>();
+    ForEachRun([&](size_type offset, size_type count) {
+      kernels.sum(_matrix + offset, other._matrix + offset, count);
+    });
+  }
+
+  template <typename V, typename = EnableIfView<V>>
+  void SumMatrix(const V& other) {
+    S21_MATRIX_STATS_SCOPE(s21::Operation::kSum, _rows * _cols);
+    View().SumMatrix(other);
   }
 
   void SubMatrix(const S21Matrix& other) {
+    S21_MATRIX_STATS_SCOPE(s21::Operation::kSub, _rows * _cols);
     CheckIsEqualSize(other);
-    for (size_type i = 0; i < _rows * _cols; ++i) {
-      _matrix[i] -= other._matrix[i];
-    }
+    const auto& kernels = s21::simd::Kernels<T>();
+    ForEachRun([&](size_type offset, size_type count) {
+      kernels.sub(_matrix + offset, other._matrix + offset, count);
+    });
   }
 
-  void MulNumber(long double num) noexcept {
-    for (size_type i = 0; i < _rows * _cols; ++i) {
-      _matrix[i] *= num;
-    }
+  template <typename V, typename = EnableIfView<V>>
+  void SubMatrix(const V& other) {
+    S21_MATRIX_STATS_SCOPE(s21::Operation::kSub, _rows * _cols);
+    View().SubMatrix(other);
   }
 
+  void MulNumber(long double num) {
+    S21_MATRIX_STATS_SCOPE(s21::Operation::kMulNumber, _rows * _cols);
+    const auto& kernels = s21::simd::Kernels<T>();
+    ForEachRun([&](size_type offset, size_type count) {
+      kernels.scale(_matrix + offset, count, num);
+    });
+  }
+
+  // MulMatrix<double>(other) of float matrices accumulates in double
+  // With a square `other` the product is written over this matrix.
+  template <typename Acc = s21::AccumulatorOf<T>>
   void MulMatrix(const S21Matrix& other) {
-    if (_cols != other._rows) {
-      std::string errmsg = std::string("this cols (") + std::to_string(_cols) +
-                           std::string(" != other rows (") +
-                           std::to_string(other._rows) + std::string(")");
-      throw std::logic_error(errmsg);
-    }
-    S21Matrix new_mtx(_rows, other._cols);
-    for (size_type r = 0; r < _rows; ++r) {
-      for (size_type m = 0; m < _cols; ++m) {
-        for (size_type c = 0; c < other._cols; ++c) {
-          new_mtx(r, c) += (*this)(r, m) * other(m, c);
-        }
-      }
+    S21_MATRIX_STATS_SCOPE(s21::Operation::kMulMatrix, _rows * other._cols);
+    if (CanMultiplyOver<Acc>(*this, other, *this)) {
+      s21::detail::GemmOverLhs(_rows, _cols, _matrix, _stride, other._matrix,
+                               other._stride);
+      return;
     }
-    *this = std::move(new_mtx);
+    *this = View().template MulMatrix<Acc>(other.View());
   }
 
-  S21Matrix Transpose() const noexcept {
-    S21Matrix mtx(_rows, _cols);
-    for (size_type r = 0; r < _rows; ++r) {
-      for (size_type c = 0; c < _cols; ++c) {
-        mtx(c, r) = (*this)(r, c);
-      }
-    }
+  template <typename V, typename = EnableIfView<V>>
+  void MulMatrix(const V& other) {
+    S21_MATRIX_STATS_SCOPE(s21::Operation::kMulMatrix,
+                           _rows * other.GetCols());
+    *this = View().MulMatrix(other);
+  }
+
+  S21Matrix Transpose() const {
+    S21_MATRIX_STATS_SCOPE(s21::Operation::kTranspose, _rows * _cols);
+    S21Matrix mtx(_cols, _rows, GetAllocator());
+    s21::detail::Transpose(_matrix, _stride, mtx._matrix, mtx._stride, _rows,
+                           _cols);
     return mtx;
   }
 
+  // transposes a square matrix without allocating
+  void TransposeInPlace() {
+    CheckIsSquareMatrix();
+    s21::detail::TransposeInPlace(_matrix, _stride, _rows);
+  }
+
+  // Up to 3x3 complements come from 2x2 minors; larger nonsingular
+  // matrices use one LU factorisation: the complements are det * (A^-1)^T.
   S21Matrix CalcComplements() const {
+    S21_MATRIX_STATS_SCOPE(s21::Operation::kCalcComplements, _rows * _cols);
     CheckIsSquareMatrix();
-    S21Matrix acomps(_cols, _rows);
+    if (_rows <= kClosedFormSize) {
+      return CalcComplementsByMinors();
+    }
+    LuFactors lu = Factorize();
+    if (std::fabs(lu.det) < kEps) {
+      return CalcComplementsByMinors();
+    }
+    std::vector<Real> inv = lu.Inverse(_rows);
+    S21Matrix acomps(_rows, _cols, GetAllocator());
     for (size_type r = 0; r < _rows; ++r) {
       for (size_type c = 0; c < _cols; ++c) {
-        acomps(r, c) = pow(-1, (r + c) % 2) * Minor(r, c);
+        acomps._matrix[r * _stride + c] =
+            static_cast<T>(lu.det * inv[c * _cols + r]);
       }
     }
     return acomps;
   }
 
   long double Determinant() const {
+    S21_MATRIX_STATS_SCOPE(s21::Operation::kDeterminant, _rows * _cols);
     CheckIsSquareMatrix();
     if (!_rows) {
       return 1.0;
@@ -141,43 +300,33 @@ class S21Matrix {
       return _matrix[0];
     }
     if (_rows == 2) {
-      return _matrix[0] * _matrix[_cols + 1] - _matrix[_cols] * _matrix[1];
+      return _matrix[0] * _matrix[_stride + 1] - _matrix[_stride] * _matrix[1];
     }
-    long double det = 1.0;
-    S21Matrix mtx{*this};
-    for (size_type r = 0; r < _rows; ++r) {
-      size_type pivot = r;
-      for (size_type s = r + 1; s < _rows; ++s) {
-        if (std::abs(mtx(s, r)) > std::abs(mtx(pivot, r))) {
-          pivot = s;
-        }
-      }
-      if (std::abs(mtx(pivot, r)) < _eps) {
-        return 0.0;
-      }
-      if (pivot != r) {
-        for (size_type c = 0; c < _cols; ++c) {
-          std::swap(mtx(pivot, c), mtx(r, c));
-        }
-        det = -det;
-      }
-      det *= mtx(r, r);
-      for (size_type t = r + 1; t < _rows; ++t) {
-        long double norm = mtx(t, r) / mtx(r, r);
-        for (size_type u = r; u < _rows; ++u) {
-          mtx(t, u) -= mtx(r, u) * norm;
-        }
-      }
-    }
-    return det;
+    return Factorize().det;
   }
 
   S21Matrix InverseMatrix() const {
-    long double det = Determinant();
-    if (fabs(det) < _eps) {
+    S21_MATRIX_STATS_SCOPE(s21::Operation::kInverse, _rows * _cols);
+    CheckIsSquareMatrix();
+    if (_rows <= kClosedFormSize) {
+      long double det = Determinant();
+      if (fabs(det) < kEps) {
+        throw std::logic_error("The determinant is zero.");
+      }
+      return Transpose().CalcComplements() * (1. / det);
+    }
+    LuFactors lu = Factorize();
+    if (fabs(lu.det) < kEps) {
       throw std::logic_error("The determinant is zero.");
     }
-    return Transpose().CalcComplements() * (1. / det);
+    std::vector<Real> inv = lu.Inverse(_rows);
+    S21Matrix mtx(_rows, _cols, GetAllocator());
+    for (size_type r = 0; r < _rows; ++r) {
+      std::transform(inv.begin() + r * _cols, inv.begin() + (r + 1) * _cols,
+                     mtx._matrix + r * _stride,
+                     [](Real value) { return static_cast<T>(value); });
+    }
+    return mtx;
   }
 
   // additional operations
@@ -189,18 +338,25 @@ class S21Matrix {
   bool IsSquare() const noexcept { return _rows == _cols; }
 
   S21Matrix MinorMatrix(size_type row, size_type col) const {
+    return MinorMatrix(row, col, GetAllocator());
+  }
+
+  // the minor in storage from `alloc`
+  S21Matrix MinorMatrix(size_type row, size_type col,
+                        const allocator_type& alloc) const {
     CheckIsSquareMatrix();
     if (!_rows) {
       throw std::out_of_range("empty matrix");
     }
-    S21Matrix mtx(_rows - 1, _cols - 1);
-    for (size_type r = 0; r < _rows; ++r) {
+    CheckIndexUpperBound(row, _rows);
+    CheckIndexUpperBound(col, _cols);
+    S21Matrix mtx(_rows - 1, _cols - 1, alloc);
+    for (size_type r = 0, dst = 0; r < _rows; ++r) {
       if (r != row) {
-        for (size_type c = 0; c < _cols; ++c) {
-          if (c != col) {
-            mtx(r - (r > row), c - (c > col)) = (*this)(r, c);
-          }
-        }
+        const T* src = RowData(r);
+        T* out = mtx.RowData(dst++);
+        std::copy_n(src, col, out);
+        std::copy(src + col + 1, src + _cols, out + col);
       }
     }
     return mtx;
@@ -217,59 +373,167 @@ class S21Matrix {
     return repr;
   }
 
+  // reductions, computed on the view (s21_matrix_reduce.h)
+
+  s21::SumOf<T> Sum() const { return View().Sum(); }
+  s21::SumOf<T> Trace() const { return View().Trace(); }
+
+  s21::SumOf<T> Dot(const S21Matrix& other) const {
+    return View().Dot(other.View());
+  }
+
+  template <typename V, typename = EnableIfView<V>>
+  s21::SumOf<T> Dot(const V& other) const {
+    return View().Dot(other);
+  }
+
+  s21::NormOf<T> NormFrobenius() const { return View().NormFrobenius(); }
+  s21::NormOf<T> Norm1() const { return View().Norm1(); }
+  s21::NormOf<T> NormInf() const { return View().NormInf(); }
+
+  T Min() const { return View().Min(); }
+  T Max() const { return View().Max(); }
+  std::tuple<size_type, size_type> ArgMin() const { return View().ArgMin(); }
+  std::tuple<size_type, size_type> ArgMax() const { return View().ArgMax(); }
+
+  S21Matrix<s21::SumOf<T>> RowSums() const { return View().RowSums(); }
+  S21Matrix<s21::SumOf<T>> ColSums() const { return View().ColSums(); }
+
+  // views
+
+  view_type View() noexcept {
+    return view_type(_matrix, _rows, _cols, _stride, _resource);
+  }
+  const_view_type View() const noexcept {
+    return const_view_type(_matrix, _rows, _cols, _stride, _resource);
+  }
+
+  // the rows x cols block whose top left element is (row, col)
+  view_type Block(size_type row, size_type col, size_type rows,
+                  size_type cols) {
+    return View().Block(row, col, rows, cols);
+  }
+  const_view_type Block(size_type row, size_type col, size_type rows,
+                        size_type cols) const {
+    return View().Block(row, col, rows, cols);
+  }
+
+  view_type Row(size_type row) { return View().Row(row); }
+  const_view_type Row(size_type row) const { return View().Row(row); }
+  view_type Col(size_type col) { return View().Col(col); }
+  const_view_type Col(size_type col) const { return View().Col(col); }
+
+  // a matrix can be passed wherever a view is expected
+  operator view_type() noexcept { return View(); }
+  operator const_view_type() const noexcept { return View(); }
+
   // getters
   size_type GetRows() const noexcept { return _rows; }
   size_type GetCols() const noexcept { return _cols; }
   std::tuple<size_type, size_type> GetDim() const noexcept {
     return std::make_tuple(_rows, _cols);
   }
+  allocator_type GetAllocator() const noexcept {
+    return allocator_type(_resource);
+  }
+  std::pmr::memory_resource* GetResource() const noexcept { return _resource; }
+
+  // Raw row-major storage: element (r, c) is Data()[r * GetStride() + c].
+  // Heap storage is kAlignment-aligned; the padding after each row holds
+  // no elements.
+  T* Data() noexcept { return _matrix; }
+  const T* Data() const noexcept { return _matrix; }
+  // the leading dimension, in elements
+  size_type GetStride() const noexcept { return _stride; }
+
+  // the `_cols` contiguous elements of a row
+  T* RowData(size_type row) noexcept {
+    assert(row < _rows);
+    return _matrix + row * _stride;
+  }
+  const T* RowData(size_type row) const noexcept {
+    assert(row < _rows);
+    return _matrix + row * _stride;
+  }
+
+  // Element access without the bounds checks of operator(), for loops
+  // whose indices are known to be valid. Only debug builds (without
+  // NDEBUG) verify the indices, with an assertion.
+  T& AtUnchecked(size_type row, size_type col) noexcept {
+    assert(row < _rows && col < _cols);
+    return _matrix[row * _stride + col];
+  }
+  const T& AtUnchecked(size_type row, size_type col) const noexcept {
+    assert(row < _rows && col < _cols);
+    return _matrix[row * _stride + col];
+  }
 
   // setters
 
-  void SetRows(size_type rows) {
-    if (_rows != rows) {
-      S21Matrix mtx{rows, _cols};
-      size_type minrow = std::min(_rows, rows);
-      for (size_type r = 0; r < minrow; ++r) {
-        for (size_type c = 0; c < _cols; ++c) {
-          mtx(r, c) = (*this)(r, c);
-        }
-      }
-      *this = std::move(mtx);
+  void SetRows(size_type rows) { SetDim(rows, _cols); }
+
+  void SetCols(size_type cols) { SetDim(_rows, cols); }
+
+  // Keeps the elements of the common top left block, new ones are zero.
+  // A shape that fits the capacity is taken in place; rows added at the
+  // same width grow the capacity geometrically, like std::vector.
+  void SetDim(size_type rows, size_type cols) {
+    if (_rows == rows && _cols == cols) return;
+    if (!rows && !cols) {
+      Clear();
+      return;
+    }
+    size_type size = StorageSizeFor(rows, cols);
+    if (_matrix && size <= _capacity) {
+      Relayout(rows, cols);
+    } else {
+      Reallocate(cols == _cols ? std::max(size, 2 * _capacity) : size, rows,
+                 cols);
     }
   }
 
-  void SetCols(size_type cols) {
-    if (_cols != cols) {
-      S21Matrix mtx{_rows, cols};
-      size_type mincol = std::min(_cols, cols);
-      for (size_type r = 0; r < _rows; ++r) {
-        for (size_type c = 0; c < mincol; ++c) {
-          mtx(r, c) = (*this)(r, c);
-        }
-      }
-      *this = std::move(mtx);
+  // capacity
+
+  // the number of rows of the current width that fit without reallocating
+  size_type GetCapacity() const noexcept {
+    return _stride ? _capacity / _stride : 0;
+  }
+
+  // makes room for `rows` rows of the current width
+  void Reserve(size_type rows) {
+    size_type size = StorageSizeFor(rows, _cols);
+    if (size > _capacity) Reallocate(size, _rows, _cols);
+  }
+
+  // gives back the capacity beyond the current rows
+  void ShrinkToFit() {
+    if (!IsInline() && StorageSize() < _capacity) {
+      Reallocate(StorageSize(), _rows, _cols);
     }
   }
 
-  void SetDim(size_type rows, size_type cols) {
-    if (_rows != rows || _cols != cols) {
-      if (_rows == rows && _cols != cols) {
-        SetCols(cols);
-      } else if (_cols == cols && _rows != rows) {
-        SetRows(rows);
-      } else {
-        S21Matrix mtx{rows, cols};
-        size_type minrow = std::min(_rows, rows);
-        size_type mincol = std::min(_cols, cols);
-        for (size_type r = 0; r < minrow; ++r) {
-          for (size_type c = 0; c < mincol; ++c) {
-            mtx(r, c) = (*this)(r, c);
-          }
-        }
-        *this = std::move(mtx);
-      }
+  // Appends a zero row and returns its elements, in amortised O(1).
+  T* AppendRow() {
+    SetDim(_rows + 1, _cols);
+    return RowData(_rows - 1);
+  }
+
+  // Appends a copy of a 1 x cols row, which may be a row of this matrix.
+  // An empty matrix takes the width of the row.
+  void AppendRow(const const_view_type& row) {
+    if (!_matrix) SetDim(0, row.GetCols());
+    if (row.GetRows() != 1 || row.GetCols() != _cols) {
+      throw std::logic_error(std::string("Size mismatch: this row ") +
+                             s21::detail::DimString(1, _cols) + " != other " +
+                             s21::detail::DimString(row.GetRows(),
+                                                    row.GetCols()));
     }
+    const T* src = row.RowData(0);
+    std::less<const T*> before;
+    bool own = !before(src, _matrix) && before(src, _matrix + _capacity);
+    size_type offset = own ? static_cast<size_type>(src - _matrix) : 0;
+    T* dst = AppendRow();
+    std::copy_n(own ? _matrix + offset : src, _cols, dst);
   }
 
   // operators
@@ -277,10 +541,9 @@ class S21Matrix {
   explicit operator bool() const noexcept { return _matrix != nullptr; }
   bool operator==(const S21Matrix& other) const { return EqMatrix(other); }
 
-  S21Matrix operator+(const S21Matrix& other) const {
-    S21Matrix mtx(*this);
-    mtx.SumMatrix(other);
-    return mtx;
+  template <typename V, typename = EnableIfView<V>>
+  bool operator==(const V& other) const {
+    return EqMatrix(other);
   }
 
   S21Matrix& operator+=(const S21Matrix& other) {
@@ -288,10 +551,15 @@ class S21Matrix {
     return *this;
   }
 
-  S21Matrix operator-(const S21Matrix& other) const {
-    S21Matrix mtx(*this);
-    mtx.SubMatrix(other);
-    return mtx;
+  template <typename V, typename = EnableIfView<V>>
+  S21Matrix& operator+=(const V& other) {
+    SumMatrix(other);
+    return *this;
+  }
+
+  template <typename E>
+  S21Matrix& operator+=(const s21::MatrixExpression<E>& expr) {
+    return *this = *this + expr;
   }
 
   S21Matrix& operator-=(const S21Matrix& other) {
@@ -299,15 +567,15 @@ class S21Matrix {
     return *this;
   }
 
-  S21Matrix operator*(long double num) const {
-    S21Matrix mtx(*this);
-    mtx.MulNumber(num);
-    return mtx;
+  template <typename V, typename = EnableIfView<V>>
+  S21Matrix& operator-=(const V& other) {
+    SubMatrix(other);
+    return *this;
   }
 
-  friend S21Matrix operator*(long double number,
-                             const S21Matrix& matrix) noexcept {
-    return matrix * number;
+  template <typename E>
+  S21Matrix& operator-=(const s21::MatrixExpression<E>& expr) {
+    return *this = *this - expr;
   }
 
   S21Matrix& operator*=(long double num) {
@@ -315,10 +583,46 @@ class S21Matrix {
     return *this;
   }
 
-  S21Matrix operator*(const S21Matrix& other) const {
-    S21Matrix mtx(*this);
-    mtx.MulMatrix(other);
-    return mtx;
+  S21Matrix operator*(const S21Matrix& other) const& {
+    S21_MATRIX_STATS_SCOPE(s21::Operation::kMulMatrix, _rows * other._cols);
+    return View().MulMatrix(other.View());
+  }
+
+  // A dying operand is overwritten by the product when it has the shape
+  // of the result, i.e. when the other operand is square, so `a * b * c`
+  // allocates once. Only scratch for a block of rows or columns is needed.
+  S21Matrix operator*(const S21Matrix& other) && {
+    S21_MATRIX_STATS_SCOPE(s21::Operation::kMulMatrix, _rows * other._cols);
+    if (!CanMultiplyOver(*this, other, *this)) {
+      return View().MulMatrix(other.View());
+    }
+    s21::detail::GemmOverLhs(_rows, _cols, _matrix, _stride, other._matrix,
+                             other._stride);
+    return std::move(*this);
+  }
+
+  S21Matrix operator*(S21Matrix&& other) const& {
+    S21_MATRIX_STATS_SCOPE(s21::Operation::kMulMatrix, _rows * other._cols);
+    if (!CanMultiplyOver(*this, other, other)) {
+      return View().MulMatrix(other.View());
+    }
+    s21::detail::GemmOverRhs(_rows, other._cols, _matrix, _stride,
+                             other._matrix, other._stride);
+    return std::move(other);
+  }
+
+  S21Matrix operator*(S21Matrix&& other) && {
+    if (CanMultiplyOver(*this, other, *this)) {
+      return std::move(*this) * std::as_const(other);
+    }
+    return std::as_const(*this) * std::move(other);
+  }
+
+  template <typename V, typename = EnableIfView<V>>
+  S21Matrix operator*(const V& other) const {
+    S21_MATRIX_STATS_SCOPE(s21::Operation::kMulMatrix,
+                           _rows * other.GetCols());
+    return View().MulMatrix(other);
   }
 
   S21Matrix& operator*=(const S21Matrix& other) {
@@ -326,12 +630,29 @@ class S21Matrix {
     return *this;
   }
 
+  template <typename V, typename = EnableIfView<V>>
+  S21Matrix& operator*=(const V& other) {
+    MulMatrix(other);
+    return *this;
+  }
+
+  // unchecked element read, the leaf of the expression templates
+  T Eval(size_type row, size_type col) const noexcept {
+    return _matrix[row * _stride + col];
+  }
+
+  // Checked element access: throws std::out_of_range. Building with
+  // S21_MATRIX_NO_BOUNDS_CHECK makes it an alias of AtUnchecked.
   const T& operator()(size_type row, size_type col) const {
+#ifdef S21_MATRIX_NO_BOUNDS_CHECK
+    return AtUnchecked(row, col);
+#else
     return GetElement(row, col);
+#endif
   }
 
   T& operator()(size_type row, size_type col) {
-    return const_cast<T&>(GetElement(row, col));
+    return const_cast<T&>(std::as_const(*this)(row, col));
   }
 
   friend std::ostream& operator<<(std::ostream& os,
@@ -341,6 +662,109 @@ class S21Matrix {
   }
 
  private:
+  // element-wise work is split across threads in multiples of this
+  static constexpr size_type kElementwiseBlock = 1024;
+  // heap storage and padded rows start on cache line boundaries
+  static constexpr size_type kAlignment = 64;
+  static constexpr size_type kPageBytes = 4096;
+  // Matrices of up to kInlineBytes (4x4 doubles) keep their elements in
+  // the object itself and never touch the memory resource.
+  static constexpr size_type kInlineBytes = 128;
+  static constexpr size_type kInlineCapacity =
+      std::max<size_type>(1, kInlineBytes / sizeof(T));
+  // pivots and determinants below it count as zero
+  static constexpr double kEps = std::numeric_limits<double>::epsilon();
+  // below this size cofactors of 2x2 minors beat the LU factorisation
+  // and stay exact for small integers
+  static constexpr size_type kClosedFormSize = 3;
+
+  using Real = s21::detail::LuReal<T>;
+
+  struct LuFactors {
+    std::vector<Real> lu;
+    std::vector<size_type> perm;
+    long double det;
+
+    std::vector<Real> Inverse(size_type n) const {
+      std::vector<Real> inv(n * n);
+      s21::detail::LuInverse(lu.data(), n, n, perm.data(), inv.data(), n);
+      return inv;
+    }
+  };
+
+  LuFactors Factorize() const {
+    LuFactors res{std::vector<Real>(_rows * _cols),
+                  std::vector<size_type>(_rows), 0.0};
+    for (size_type r = 0; r < _rows; ++r) {
+      std::copy_n(_matrix + r * _stride, _cols, res.lu.begin() + r * _cols);
+    }
+    s21::detail::LuInfo info = s21::detail::LuFactor(
+        res.lu.data(), _rows, _cols, res.perm.data(), kEps);
+    res.det = s21::detail::LuDeterminant(res.lu.data(), _rows, _cols, info);
+    return res;
+  }
+
+  // whether lhs * rhs may be written over `target`, one of the two: the
+  // shapes agree, the other operand is square and a distinct object, and
+  // the products are accumulated in T itself
+  template <typename Acc = s21::AccumulatorOf<T>>
+  static bool CanMultiplyOver(const S21Matrix& lhs, const S21Matrix& rhs,
+                              const S21Matrix& target) noexcept {
+    if (!std::is_same_v<Acc, T> || &lhs == &rhs) return false;
+    const S21Matrix& other = &target == &lhs ? rhs : lhs;
+    return lhs._cols == rhs._rows && other.IsSquare() && target._matrix;
+  }
+
+  S21Matrix CalcComplementsByMinors() const {
+    S21Matrix acomps(_cols, _rows, GetAllocator());
+    // Each cell costs a determinant of an (n - 1) x (n - 1) minor. The
+    // minors are built on worker threads, so they are allocated from
+    // new/delete rather than from _resource, which need not be thread-safe.
+    allocator_type scratch(std::pmr::new_delete_resource());
+    s21::ParallelFor(
+        _rows * _cols, _rows * _rows * _rows,
+        [&](size_type begin, size_type end) {
+          for (size_type i = begin; i < end; ++i) {
+            size_type r = i / _cols, c = i % _cols;
+            acomps.AtUnchecked(r, c) =
+                pow(-1, (r + c) % 2) *
+                MinorMatrix(r, c, scratch).Determinant();
+          }
+        });
+    return acomps;
+  }
+
+  // Exchanges contents with `other`. Heap buffers swap pointers,
+  // inline elements are copied across.
+  void Swap(S21Matrix& other) noexcept {
+    size_type size = StorageSize(), other_size = other.StorageSize();
+    if (IsInline() && other.IsInline()) {
+      size_type common = std::min(size, other_size);
+      std::swap_ranges(_inline, _inline + common, other._inline);
+      if (size < other_size) {
+        std::copy(other._inline + common, other._inline + other_size,
+                  _inline + common);
+      } else {
+        std::copy(_inline + common, _inline + size, other._inline + common);
+      }
+    } else if (IsInline()) {
+      std::copy_n(_inline, size, other._inline);
+      _matrix = other._matrix;
+      other._matrix = other._inline;
+    } else if (other.IsInline()) {
+      std::copy_n(other._inline, other_size, _inline);
+      other._matrix = _matrix;
+      _matrix = _inline;
+    } else {
+      std::swap(_matrix, other._matrix);
+    }
+    std::swap(_rows, other._rows);
+    std::swap(_cols, other._cols);
+    std::swap(_stride, other._stride);
+    std::swap(_capacity, other._capacity);
+    std::swap(_resource, other._resource);
+  }
+
   void CheckIndexUpperBound(size_type idx, size_type upper) const {
     if (idx >= upper) {
       std::string errmsg = "index ";
@@ -369,13 +793,156 @@ class S21Matrix {
     }
   }
 
+  bool IsInline() const noexcept { return _matrix == _inline; }
+
+  // Rows narrower than a cache line stay dense. Wider ones are padded to
+  // whole lines, and a stride that is a multiple of the page size gets one
+  // more line so that consecutive rows do not alias in the caches.
+  // The stride only depends on the column count, so matrices of the same
+  // shape share it.
+  static size_type StrideFor(size_type cols) noexcept {
+    if constexpr (kAlignment % sizeof(T)) {
+      return cols;
+    } else {
+      constexpr size_type kLine = kAlignment / sizeof(T);
+      if (cols * sizeof(T) < kAlignment) return cols;
+      size_type stride = (cols + kLine - 1) / kLine * kLine;
+      if (stride * sizeof(T) % kPageBytes == 0) stride += kLine;
+      return stride;
+    }
+  }
+
+  size_type StorageSize() const noexcept { return _rows * _stride; }
+
+  // rows * StrideFor(cols), when storage of that many elements could be
+  // addressed at all; a wrapped product would allocate too little
+  static size_type StorageSizeFor(size_type rows, size_type cols) {
+    constexpr size_type kMax =
+        std::numeric_limits<size_type>::max() / sizeof(T);
+    // StrideFor adds less than two cache lines
+    if (cols > kMax - 2 * kAlignment) throw std::bad_array_new_length();
+    size_type stride = StrideFor(cols);
+    if (rows && stride > kMax / rows) throw std::bad_array_new_length();
+    return rows * stride;
+  }
+
+  // zero-initialised storage for `size` elements, inline when it fits
+  T* Allocate(size_type size) {
+    if (size <= kInlineCapacity) {
+      std::fill_n(_inline, size, T{});
+      return _inline;
+    }
+    if (size > std::numeric_limits<size_type>::max() / sizeof(T)) {
+      throw std::bad_array_new_length();
+    }
+    T* data =
+        static_cast<T*>(_resource->allocate(size * sizeof(T), kAlignment));
+    S21_MATRIX_STATS_COUNT(CountAllocation(size * sizeof(T)));
+    std::uninitialized_value_construct_n(data, size);
+    return data;
+  }
+
+  // elements available at `data` that was allocated for `size`
+  size_type CapacityOf(const T* data, size_type size) const noexcept {
+    return data == _inline ? kInlineCapacity : size;
+  }
+
+  // Moves the elements to new storage for `capacity` elements, in which
+  // the matrix takes the shape rows x cols like in Relayout.
+  void Reallocate(size_type capacity, size_type rows, size_type cols) {
+    if (IsInline() && capacity <= kInlineCapacity) {
+      Relayout(rows, cols);
+      return;
+    }
+    T* data = Allocate(capacity);
+    size_type stride = StrideFor(cols);
+    size_type minrow = std::min(_rows, rows), mincol = std::min(_cols, cols);
+    for (size_type r = 0; r < minrow; ++r) {
+      std::copy_n(_matrix + r * _stride, mincol, data + r * stride);
+    }
+    Clear();
+    _matrix = data;
+    _capacity = CapacityOf(data, capacity);
+    _rows = rows;
+    _cols = cols;
+    _stride = stride;
+  }
+
+  // Reshapes the matrix within its capacity, keeping the common top left
+  // block and zeroing the rest. Rows move with memmove when the stride
+  // changes: towards the front when it shrinks, from the back when it
+  // grows, so no row is overwritten before it has moved.
+  void Relayout(size_type rows, size_type cols) {
+    size_type stride = StrideFor(cols);
+    assert(rows * stride <= _capacity);
+    size_type minrow = std::min(_rows, rows), mincol = std::min(_cols, cols);
+    if (stride < _stride) {
+      for (size_type r = 1; r < minrow; ++r) {
+        std::memmove(_matrix + r * stride, _matrix + r * _stride,
+                     mincol * sizeof(T));
+      }
+    } else if (stride > _stride) {
+      for (size_type r = minrow; r-- > 1;) {
+        std::memmove(_matrix + r * stride, _matrix + r * _stride,
+                     mincol * sizeof(T));
+      }
+    }
+    if (cols != _cols) {
+      // new columns and the padding, which may hold moved elements
+      for (size_type r = 0; r < minrow; ++r) {
+        std::fill(_matrix + r * stride + mincol, _matrix + (r + 1) * stride,
+                  T{});
+      }
+    }
+    std::fill(_matrix + minrow * stride, _matrix + rows * stride, T{});
+    _rows = rows;
+    _cols = cols;
+    _stride = stride;
+  }
+
+  // Calls body(offset, count) for runs of elements that together cover
+  // every row, in parallel: one flat range when rows are dense, a run per
+  // row when they are padded. Matrices of the same shape share the
+  // stride, so the offsets are valid for both operands of an
+  // element-wise operation.
+  template <typename F>
+  void ForEachRun(F&& body) const {
+    if (_stride == _cols) {
+      s21::ParallelFor(
+          _rows * _cols, 1,
+          [&](size_type begin, size_type end) { body(begin, end - begin); },
+          kElementwiseBlock);
+    } else {
+      s21::ParallelFor(_rows, _cols, [&](size_type begin, size_type end) {
+        for (size_type r = begin; r < end; ++r) body(r * _stride, _cols);
+      });
+    }
+  }
+
   void Clear() noexcept {
-    delete[] _matrix;
+    if (_matrix && !IsInline()) {
+      _resource->deallocate(_matrix, _capacity * sizeof(T), kAlignment);
+    }
     _rows = 0;
     _cols = 0;
+    _stride = 0;
+    _capacity = 0;
     _matrix = nullptr;
   }
 
+  template <typename E>
+  void Assign(const E& expr) {
+    S21_MATRIX_STATS_SCOPE(s21::Operation::kEvaluate, _rows * _cols);
+    s21::ParallelFor(_rows, _cols, [&](size_type begin, size_type end) {
+      for (size_type r = begin; r < end; ++r) {
+        T* row = _matrix + r * _stride;
+        for (size_type c = 0; c < _cols; ++c) {
+          row[c] = static_cast<T>(expr.Eval(r, c));
+        }
+      }
+    });
+  }
+
   std::string GetDimString() const noexcept {
     std::string dimstr = "(";
     dimstr += std::to_string(_rows);
@@ -388,7 +955,7 @@ class S21Matrix {
   const T& GetElement(size_type row, size_type col) const {
     CheckIndexUpperBound(row, _rows);
     CheckIndexUpperBound(col, _cols);
-    return _matrix[row * _cols + col];
+    return _matrix[row * _stride + col];
   }
 
   std::string GetMatrixString() const noexcept {
@@ -401,10 +968,11 @@ class S21Matrix {
     std::string repr = std::string("[");
     for (size_type r = 0; r < _rows; ++r) {
       repr += "[";
+      const T* row = RowData(r);
       for (size_type c = 0; c < _cols - 1; ++c) {
-        repr += std::to_string((*this)(r, c)) + ", ";
+        repr += std::to_string(row[c]) + ", ";
       }
-      repr += std::to_string((*this)(r, _cols - 1)) + "]";
+      repr += std::to_string(row[_cols - 1]) + "]";
       if (r != _rows - 1) repr += "; ";
     }
     repr += "]";
@@ -412,8 +980,119 @@ class S21Matrix {
   }
 
   size_type _rows, _cols;
+  size_type _stride;    // leading dimension
+  size_type _capacity;  // elements at _matrix
   T* _matrix;
-  double _eps{std::numeric_limits<double>::epsilon()};
+  std::pmr::memory_resource* _resource;
+  T _inline[kInlineCapacity];
 };
 
+namespace s21 {
+
+// Operators over expressions that are not covered by S21Matrix members:
+// they evaluate the expression operands first.
+
+// Operands of different element types are first converted to the
+// Promoted one: float and double matrices compare and multiply as double.
+template <typename L, typename R, typename = void>
+inline constexpr bool kNeedsEvaluation = false;
+
+template <typename L, typename R>
+inline constexpr bool kNeedsEvaluation<
+    L, R,
+    std::enable_if_t<kIsMatrixExpression<L> && kIsMatrixExpression<R>>> =
+    !(L::kIsExpressionLeaf && R::kIsExpressionLeaf) ||
+    !std::is_same_v<typename L::value_type, typename R::value_type>;
+
+template <typename L, typename R>
+using PromotedMatrix =
+    S21Matrix<Promoted<typename L::value_type, typename R::value_type>>;
+
+template <typename L, typename R,
+          typename = std::enable_if_t<kNeedsEvaluation<L, R>>>
+bool operator==(const L& lhs, const R& rhs) {
+  using Matrix = PromotedMatrix<L, R>;
+  return Matrix(lhs).EqMatrix(Matrix(rhs));
+}
+
+template <typename L, typename R,
+          typename = std::enable_if_t<kNeedsEvaluation<L, R>>>
+PromotedMatrix<L, R> operator*(const L& lhs, const R& rhs) {
+  using Matrix = PromotedMatrix<L, R>;
+  Matrix mtx(lhs);
+  if constexpr (std::is_same_v<typename R::value_type,
+                               typename Matrix::value_type>) {
+    mtx.MulMatrix(rhs);
+  } else {
+    mtx.MulMatrix(Matrix(rhs));
+  }
+  return mtx;
+}
+
+// A dying S21Matrix operand of +, - or a scalar * takes the result in its
+// own storage instead of becoming a leaf of a lazy expression, so
+// `(a * b) + c` allocates for the product only, and no expression is
+// left referring to a destroyed temporary.
+template <typename T, typename E>
+using EnableIfSameElements =
+    std::enable_if_t<std::is_same_v<typename E::value_type, T>, int>;
+
+template <typename T, typename R, EnableIfSameElements<T, R> = 0>
+S21Matrix<T> operator+(S21Matrix<T>&& lhs, const MatrixExpression<R>& rhs) {
+  lhs += rhs.Self();
+  return std::move(lhs);
+}
+
+template <typename L, typename T, EnableIfSameElements<T, L> = 0>
+S21Matrix<T> operator+(const MatrixExpression<L>& lhs, S21Matrix<T>&& rhs) {
+  rhs += lhs.Self();
+  return std::move(rhs);
+}
+
+template <typename T>
+S21Matrix<T> operator+(S21Matrix<T>&& lhs, S21Matrix<T>&& rhs) {
+  lhs += rhs;
+  return std::move(lhs);
+}
+
+template <typename T, typename R, EnableIfSameElements<T, R> = 0>
+S21Matrix<T> operator-(S21Matrix<T>&& lhs, const MatrixExpression<R>& rhs) {
+  lhs -= rhs.Self();
+  return std::move(lhs);
+}
+
+// each element of rhs is read only to compute itself, so the difference
+// is evaluated in place
+template <typename L, typename T, EnableIfSameElements<T, L> = 0>
+S21Matrix<T> operator-(const MatrixExpression<L>& lhs, S21Matrix<T>&& rhs) {
+  rhs = lhs.Self() - rhs;
+  return std::move(rhs);
+}
+
+template <typename T>
+S21Matrix<T> operator-(S21Matrix<T>&& lhs, S21Matrix<T>&& rhs) {
+  lhs -= rhs;
+  return std::move(lhs);
+}
+
+template <typename T>
+S21Matrix<T> operator*(S21Matrix<T>&& mtx, long double factor) {
+  mtx.MulNumber(factor);
+  return std::move(mtx);
+}
+
+template <typename T>
+S21Matrix<T> operator*(long double factor, S21Matrix<T>&& mtx) {
+  mtx.MulNumber(factor);
+  return std::move(mtx);
+}
+
+template <typename E, typename = std::enable_if_t<kIsMatrixExpression<E> &&
+                                                  !E::kIsExpressionLeaf>>
+std::ostream& operator<<(std::ostream& os, const E& expr) {
+  return os << S21Matrix<typename E::value_type>(expr);
+}
+
+}  // namespace s21
+
 #endif  // S21_MATRIXPLUSPLUS_SRC_S21_MATRIX_H_
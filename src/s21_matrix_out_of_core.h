@@ -0,0 +1,309 @@
+#ifndef S21_MATRIXPLUSPLUS_SRC_S21_MATRIX_OUT_OF_CORE_H_
+#define S21_MATRIXPLUSPLUS_SRC_S21_MATRIX_OUT_OF_CORE_H_
+
+#include <fcntl.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include <algorithm>
+#include <cerrno>
+#include <chrono>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <future>
+#include <stdexcept>
+#include <string>
+#include <system_error>
+#include <vector>
+
+#include "s21_matrix_binary.h"
+#include "s21_matrix_gemm.h"
+
+// Products of matrices stored in binary files (s21_matrix_binary.h) that
+// need not fit in memory. The result is computed a tile at a time: a tile
+// of C stays in memory while the matching tiles of A and B are read with
+// pread() and multiplied into it, then it is written to the output file.
+// Reading goes through explicit buffers rather than a mapping so that the
+// memory used is bounded by the budget, not by the page cache.
+//
+// With `prefetch`, the tiles of the next step are read on a background
+// thread while the current ones are multiplied and a finished C tile is
+// written, so a product bound by the kernel hides its I/O. The pair being
+// read takes a second set of buffers out of the same budget.
+namespace s21 {
+
+struct OutOfCoreOptions {
+  // bytes of A, B and C tiles held at once, the prefetched ones included
+  std::size_t memory_budget = std::size_t{256} << 20;
+  bool prefetch = true;
+};
+
+struct OutOfCoreReport {
+  // a C tile is tile_rows x tile_cols, summed over tile_inner columns of A
+  std::size_t tile_rows = 0;
+  std::size_t tile_inner = 0;
+  std::size_t tile_cols = 0;
+  std::size_t buffer_bytes = 0;
+  std::uint64_t bytes_read = 0;
+  std::uint64_t bytes_written = 0;
+  // time the multiplication waited for tiles, all of the reading
+  // without prefetch
+  std::uint64_t stall_nanoseconds = 0;
+};
+
+namespace detail {
+
+class FileDescriptor {
+ public:
+  FileDescriptor(const std::string& path, int flags, mode_t mode = 0)
+      : _fd(::open(path.c_str(), flags, mode)), _path(path) {
+    if (_fd < 0) {
+      throw std::system_error(errno, std::generic_category(),
+                              "cannot open " + path);
+    }
+  }
+
+  FileDescriptor(const FileDescriptor&) = delete;
+  FileDescriptor& operator=(const FileDescriptor&) = delete;
+
+  ~FileDescriptor() noexcept { ::close(_fd); }
+
+  int Get() const noexcept { return _fd; }
+  const std::string& Path() const noexcept { return _path; }
+
+  struct stat Stat() const {
+    struct stat st;
+    if (::fstat(_fd, &st) < 0) {
+      throw std::system_error(errno, std::generic_category(),
+                              "cannot stat " + _path);
+    }
+    return st;
+  }
+
+ private:
+  int _fd;
+  std::string _path;
+};
+
+// pread()/pwrite() of exactly `bytes`, across short transfers and signals
+inline void ReadAt(const FileDescriptor& file, void* dst, std::size_t bytes,
+                   std::uint64_t offset) {
+  char* out = static_cast<char*>(dst);
+  while (bytes) {
+    ssize_t done = ::pread(file.Get(), out, bytes, offset);
+    if (done < 0 && errno == EINTR) continue;
+    if (done < 0) {
+      throw std::system_error(errno, std::generic_category(),
+                              "cannot read " + file.Path());
+    }
+    if (!done) throw std::runtime_error("truncated matrix data");
+    out += done;
+    bytes -= done;
+    offset += done;
+  }
+}
+
+inline void WriteAt(const FileDescriptor& file, const void* src,
+                    std::size_t bytes, std::uint64_t offset) {
+  const char* in = static_cast<const char*>(src);
+  while (bytes) {
+    ssize_t done = ::pwrite(file.Get(), in, bytes, offset);
+    if (done < 0 && errno == EINTR) continue;
+    if (done < 0) {
+      throw std::system_error(errno, std::generic_category(),
+                              "cannot write " + file.Path());
+    }
+    in += done;
+    bytes -= done;
+    offset += done;
+  }
+}
+
+// The validated header of an operand file in the host byte order.
+template <typename T>
+BinaryHeader ReadOperandHeader(const FileDescriptor& file) {
+  BinaryHeader header;
+  ReadAt(file, &header, sizeof(header), 0);
+  if (CheckBinaryHeader<T>(header)) {
+    throw std::runtime_error(
+        "the file has a foreign byte order; use LoadBinary");
+  }
+  if (BinaryExtent(header, sizeof(T)) >
+      static_cast<std::uint64_t>(file.Stat().st_size)) {
+    throw std::runtime_error("truncated matrix data");
+  }
+  return header;
+}
+
+// Reads the rows x cols block at (row, col) densely into `dst`.
+template <typename T>
+std::uint64_t ReadTile(const FileDescriptor& file, const BinaryHeader& header,
+                       std::size_t row, std::size_t col, std::size_t rows,
+                       std::size_t cols, T* dst) {
+  std::uint64_t offset = header.data_offset + (row * header.stride + col) *
+                                                  sizeof(T);
+  if (cols == header.stride) {
+    ReadAt(file, dst, rows * cols * sizeof(T), offset);
+  } else {
+    for (std::size_t r = 0; r < rows; ++r) {
+      ReadAt(file, dst + r * cols, cols * sizeof(T),
+             offset + r * header.stride * sizeof(T));
+    }
+  }
+  return rows * cols * sizeof(T);
+}
+
+inline std::size_t SquareRoot(std::size_t value) noexcept {
+  auto root = static_cast<std::size_t>(std::sqrt(static_cast<double>(value)));
+  while (root && root * root > value) --root;
+  while ((root + 1) * (root + 1) <= value) ++root;
+  return root;
+}
+
+// Tile sizes for an m x k by k x n product within `elements` of memory:
+// `buffers` sets of A and B tiles and one C tile. Square tiles to start
+// with, then each dimension in turn grows into what the clamped ones
+// leave, so thin operands get long tiles.
+inline void ChooseTiles(std::size_t m, std::size_t k, std::size_t n,
+                        std::size_t elements, std::size_t buffers,
+                        OutOfCoreReport& report) {
+  std::size_t side = SquareRoot(elements / (2 * buffers + 1));
+  if (!side) {
+    throw std::invalid_argument("memory budget too small: " +
+                                std::to_string(elements) + " elements");
+  }
+  std::size_t mb = std::min(m, side), kb = std::min(k, side);
+  std::size_t nb = std::min(
+      n, (elements - buffers * mb * kb) / (buffers * kb + mb));
+  mb = std::min(m, (elements - buffers * kb * nb) / (buffers * kb + nb));
+  kb = std::min(k, (elements - mb * nb) / (buffers * (mb + nb)));
+  report.tile_rows = mb;
+  report.tile_inner = kb;
+  report.tile_cols = nb;
+}
+
+inline std::size_t Tiles(std::size_t size, std::size_t tile) noexcept {
+  return (size + tile - 1) / tile;
+}
+
+}  // namespace detail
+
+// Writes the product of the matrices in `lhs_path` and `rhs_path` to
+// `out_path` as a binary matrix file, holding at most
+// `options.memory_budget` bytes of tiles in memory; the packing buffers
+// of the kernel add about one more pair of A and B tiles per thread.
+// The operands must be in the host byte order. Each C tile is
+// accumulated over the inner dimension in order, tile after tile.
+template <typename T>
+OutOfCoreReport OutOfCoreMulMatrix(const std::string& lhs_path,
+                                   const std::string& rhs_path,
+                                   const std::string& out_path,
+                                   const OutOfCoreOptions& options = {}) {
+  detail::FileDescriptor lhs(lhs_path, O_RDONLY);
+  detail::FileDescriptor rhs(rhs_path, O_RDONLY);
+  BinaryHeader a = detail::ReadOperandHeader<T>(lhs);
+  BinaryHeader b = detail::ReadOperandHeader<T>(rhs);
+  if (a.cols != b.rows) {
+    std::string errmsg = std::string("this cols (") + std::to_string(a.cols) +
+                         std::string(" != other rows (") +
+                         std::to_string(b.rows) + std::string(")");
+    throw std::logic_error(errmsg);
+  }
+  std::size_t m = a.rows, k = a.cols, n = b.cols;
+  if (n && m > UINT64_MAX / sizeof(T) / n) {
+    throw std::length_error("the product is too large");
+  }
+  struct stat target;
+  if (::stat(out_path.c_str(), &target) == 0) {
+    for (const detail::FileDescriptor* operand : {&lhs, &rhs}) {
+      struct stat st = operand->Stat();
+      if (st.st_dev == target.st_dev && st.st_ino == target.st_ino) {
+        throw std::invalid_argument("the product would overwrite " +
+                                    operand->Path());
+      }
+    }
+  }
+  S21_MATRIX_STATS_SCOPE(Operation::kMulMatrix, m * n);
+
+  detail::FileDescriptor out(out_path, O_WRONLY | O_CREAT | O_TRUNC, 0666);
+  BinaryHeader c = detail::MakeBinaryHeader<T>(m, n);
+  // the elements read back as zeros until they are written
+  if (::ftruncate(out.Get(), detail::BinaryExtent(c, sizeof(T))) < 0) {
+    throw std::system_error(errno, std::generic_category(),
+                            "cannot resize " + out_path);
+  }
+  detail::WriteAt(out, &c, sizeof(c), 0);
+  OutOfCoreReport report;
+  report.bytes_written = sizeof(c);
+  if (!m || !n || !k) return report;
+
+  std::size_t buffers = options.prefetch ? 2 : 1;
+  detail::ChooseTiles(m, k, n, options.memory_budget / sizeof(T), buffers,
+                      report);
+  std::size_t mb = report.tile_rows, kb = report.tile_inner;
+  std::size_t nb = report.tile_cols;
+  std::vector<T> a_tiles[2], b_tiles[2];
+  for (std::size_t i = 0; i < buffers; ++i) {
+    a_tiles[i].resize(mb * kb);
+    b_tiles[i].resize(kb * nb);
+  }
+  std::vector<T> c_tile(mb * nb);
+  report.buffer_bytes = (buffers * (mb * kb + kb * nb) + mb * nb) * sizeof(T);
+
+  // step s is the product of tiles (i, p) and (p, j) for the C tile (i, j),
+  // with p running fastest
+  std::size_t mt = detail::Tiles(m, mb), nt = detail::Tiles(n, nb);
+  std::size_t kt = detail::Tiles(k, kb);
+  std::size_t steps = mt * nt * kt;
+  auto load = [&](std::size_t step, std::size_t buffer) {
+    std::size_t i0 = step / (nt * kt) * mb, j0 = step / kt % nt * nb;
+    std::size_t p0 = step % kt * kb;
+    std::size_t rows = std::min(mb, m - i0), cols = std::min(nb, n - j0);
+    std::size_t inner = std::min(kb, k - p0);
+    return detail::ReadTile(lhs, a, i0, p0, rows, inner,
+                            a_tiles[buffer].data()) +
+           detail::ReadTile(rhs, b, p0, j0, inner, cols,
+                            b_tiles[buffer].data());
+  };
+
+  report.bytes_read += load(0, 0);
+  for (std::size_t step = 0; step < steps; ++step) {
+    std::size_t buffer = step % buffers;
+    std::future<std::uint64_t> next;
+    if (options.prefetch && step + 1 < steps) {
+      next = std::async(std::launch::async, load, step + 1, 1 - buffer);
+    }
+    std::size_t i0 = step / (nt * kt) * mb, j0 = step / kt % nt * nb;
+    std::size_t p = step % kt;
+    std::size_t rows = std::min(mb, m - i0), cols = std::min(nb, n - j0);
+    std::size_t inner = std::min(kb, k - p * kb);
+    if (!p) std::fill_n(c_tile.data(), rows * cols, T{});
+    detail::Gemm(rows, cols, inner, a_tiles[buffer].data(), inner,
+                 b_tiles[buffer].data(), cols, c_tile.data(), cols);
+    if (p + 1 == kt) {
+      std::uint64_t offset = c.data_offset + (i0 * n + j0) * sizeof(T);
+      if (cols == n) {
+        detail::WriteAt(out, c_tile.data(), rows * cols * sizeof(T), offset);
+      } else {
+        for (std::size_t r = 0; r < rows; ++r) {
+          detail::WriteAt(out, c_tile.data() + r * cols, cols * sizeof(T),
+                          offset + r * n * sizeof(T));
+        }
+      }
+      report.bytes_written += rows * cols * sizeof(T);
+    }
+    if (step + 1 == steps) break;
+    auto start = std::chrono::steady_clock::now();
+    report.bytes_read += next.valid() ? next.get() : load(step + 1, 0);
+    report.stall_nanoseconds += static_cast<std::uint64_t>(
+        std::chrono::duration_cast<std::chrono::nanoseconds>(
+            std::chrono::steady_clock::now() - start)
+            .count());
+  }
+  return report;
+}
+
+}  // namespace s21
+
+#endif  // S21_MATRIXPLUSPLUS_SRC_S21_MATRIX_OUT_OF_CORE_H_
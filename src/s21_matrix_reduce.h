@@ -0,0 +1,357 @@
+#ifndef S21_MATRIXPLUSPLUS_SRC_S21_MATRIX_REDUCE_H_
+#define S21_MATRIXPLUSPLUS_SRC_S21_MATRIX_REDUCE_H_
+
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <type_traits>
+#include <vector>
+
+#include "s21_matrix_simd.h"
+#include "s21_matrix_thread_pool.h"
+#include "s21_matrix_traits.h"
+
+// Reductions of a strided block of elements: sums, dot products, norms
+// and extrema. Sums are pairwise: blocks of 128 terms are summed in 16
+// interleaved lanes, which the compiler keeps in vector registers, and
+// the block sums are added in a balanced tree, so the rounding error
+// grows with log(n) rather than n. Large blocks are cut into pieces of a
+// fixed size spread across threads; the partial results are combined in
+// the same order whatever the number of threads, so results are
+// reproducible bit for bit.
+namespace s21 {
+
+// The type norms of T are computed in: T for floating types, double for
+// integers, whose squares would overflow.
+template <typename T>
+using NormOf = std::conditional_t<std::is_floating_point_v<AccumulatorOf<T>>,
+                                  AccumulatorOf<T>, double>;
+
+// The type sums and dot products of T are computed in: the accumulator
+// for floating types, and 64-bit integers of the same signedness for
+// integers, so that sums of small integers neither wrap nor overflow and
+// the sum of a bool matrix counts its true elements.
+template <typename T>
+using SumOf = std::conditional_t<
+    std::is_floating_point_v<AccumulatorOf<T>>, AccumulatorOf<T>,
+    std::conditional_t<std::is_signed_v<T>, std::int64_t, std::uint64_t>>;
+
+namespace detail {
+
+inline constexpr std::size_t kReduceLanes = 16;
+inline constexpr std::size_t kReduceBlock = 8 * kReduceLanes;
+// the elements of a piece handed to one kernel call
+inline constexpr std::size_t kReducePiece = 4096;
+
+// term(0) + ... + term(n - 1) summed pairwise in A, without recursion so
+// that the whole sum inlines into the kernels below
+template <typename A, typename F>
+A PairwiseSum(std::size_t n, F&& term) noexcept {
+  A pending[64];
+  std::size_t depth = 0;
+  std::size_t i = 0;
+  for (std::size_t block = 1; i < n; ++block) {
+    std::size_t end = std::min(n, i + kReduceBlock);
+    A lanes[kReduceLanes] = {};
+    if (end - i == kReduceBlock) {
+      // the terms first: a plain map, which vectorises whatever term is
+      A terms[kReduceBlock];
+      for (std::size_t j = 0; j < kReduceBlock; ++j) terms[j] = term(i + j);
+      for (std::size_t j = 0; j < kReduceBlock; j += kReduceLanes) {
+        for (std::size_t l = 0; l < kReduceLanes; ++l) lanes[l] += terms[j + l];
+      }
+      i = end;
+    }
+    for (; i + kReduceLanes <= end; i += kReduceLanes) {
+      for (std::size_t l = 0; l < kReduceLanes; ++l) lanes[l] += term(i + l);
+    }
+    for (std::size_t l = 0; i < end; ++i, ++l) lanes[l] += term(i);
+    for (std::size_t width = kReduceLanes / 2; width; width /= 2) {
+      for (std::size_t l = 0; l < width; ++l) lanes[l] += lanes[l + width];
+    }
+    // block sums merge like the carries of a binary counter
+    A sum = lanes[0];
+    for (std::size_t carry = block; !(carry & 1); carry >>= 1) {
+      sum = pending[--depth] + sum;
+    }
+    pending[depth++] = sum;
+  }
+  A total{};
+  while (depth) total = pending[--depth] + total;
+  return total;
+}
+
+template <typename A, typename T>
+A Magnitude(T x) noexcept {
+  if constexpr (std::is_floating_point_v<T>) {
+    return static_cast<A>(std::fabs(x));
+  } else if constexpr (std::is_signed_v<T>) {
+    A value = static_cast<A>(x);
+    return value < 0 ? -value : value;
+  } else {
+    return static_cast<A>(x);
+  }
+}
+
+// The kernels over n contiguous elements, written so that GCC vectorises
+// them at -O3: fixed lanes and branch-free minima and maxima.
+template <typename T>
+struct GenericReductions {
+  using Acc = SumOf<T>;
+  using Norm = NormOf<T>;
+
+  static Acc Sum(const T* x, std::size_t n) noexcept {
+    return PairwiseSum<Acc>(n, [x](std::size_t i) {
+      return static_cast<Acc>(x[i]);
+    });
+  }
+
+  static Norm SumAbs(const T* x, std::size_t n) noexcept {
+    return PairwiseSum<Norm>(
+        n, [x](std::size_t i) { return Magnitude<Norm>(x[i]); });
+  }
+
+  static Norm SumSquares(const T* x, std::size_t n) noexcept {
+    return PairwiseSum<Norm>(n, [x](std::size_t i) {
+      Norm value = static_cast<Norm>(x[i]);
+      return value * value;
+    });
+  }
+
+  static Acc Dot(const T* x, const T* y, std::size_t n) noexcept {
+    return PairwiseSum<Acc>(n, [x, y](std::size_t i) {
+      return static_cast<Acc>(x[i]) * static_cast<Acc>(y[i]);
+    });
+  }
+
+  // n >= 1 for the extrema
+  static T Min(const T* x, std::size_t n) noexcept {
+    return Extremum(x, n, [](T a, T b) { return a < b ? a : b; });
+  }
+
+  static T Max(const T* x, std::size_t n) noexcept {
+    return Extremum(x, n, [](T a, T b) { return b < a ? a : b; });
+  }
+
+  // acc[i] += x[i], the step of the column sums
+  static void Add(Acc* acc, const T* x, std::size_t n) noexcept {
+    for (std::size_t i = 0; i < n; ++i) acc[i] += static_cast<Acc>(x[i]);
+  }
+
+  static void AddAbs(Norm* acc, const T* x, std::size_t n) noexcept {
+    for (std::size_t i = 0; i < n; ++i) acc[i] += Magnitude<Norm>(x[i]);
+  }
+
+ private:
+  template <typename Pick>
+  static T Extremum(const T* x, std::size_t n, Pick pick) noexcept {
+    T lanes[kReduceLanes];
+    std::fill_n(lanes, kReduceLanes, x[0]);
+    std::size_t i = 0;
+    for (; i + kReduceLanes <= n; i += kReduceLanes) {
+      for (std::size_t l = 0; l < kReduceLanes; ++l) {
+        lanes[l] = pick(x[i + l], lanes[l]);
+      }
+    }
+    for (; i < n; ++i) lanes[0] = pick(x[i], lanes[0]);
+    for (std::size_t width = kReduceLanes / 2; width; width /= 2) {
+      for (std::size_t l = 0; l < width; ++l) {
+        lanes[l] = pick(lanes[l + width], lanes[l]);
+      }
+    }
+    return lanes[0];
+  }
+};
+
+#if defined(S21_MATRIX_SIMD_X86)
+
+// The generic kernels compiled for wider vector registers. `flatten`
+// inlines the pairwise sums, which GCC would otherwise keep out of line
+// for their stack of partial sums, and so compiles them for the target.
+#define S21_MATRIX_REDUCTIONS_FOR(Name, Target)                             \
+  template <typename T>                                                     \
+  struct Name {                                                             \
+    using G = GenericReductions<T>;                                         \
+    using Acc = typename G::Acc;                                            \
+    using Norm = typename G::Norm;                                          \
+    __attribute__((target(Target), flatten)) static Acc Sum(                \
+        const T* x, std::size_t n) noexcept {                               \
+      return G::Sum(x, n);                                                  \
+    }                                                                       \
+    __attribute__((target(Target), flatten)) static Norm SumAbs(            \
+        const T* x, std::size_t n) noexcept {                               \
+      return G::SumAbs(x, n);                                               \
+    }                                                                       \
+    __attribute__((target(Target), flatten)) static Norm SumSquares(        \
+        const T* x, std::size_t n) noexcept {                               \
+      return G::SumSquares(x, n);                                           \
+    }                                                                       \
+    __attribute__((target(Target), flatten)) static Acc Dot(                \
+        const T* x, const T* y, std::size_t n) noexcept {                   \
+      return G::Dot(x, y, n);                                               \
+    }                                                                       \
+    __attribute__((target(Target), flatten)) static T Min(                  \
+        const T* x, std::size_t n) noexcept {                               \
+      return G::Min(x, n);                                                  \
+    }                                                                       \
+    __attribute__((target(Target), flatten)) static T Max(                  \
+        const T* x, std::size_t n) noexcept {                               \
+      return G::Max(x, n);                                                  \
+    }                                                                       \
+    __attribute__((target(Target), flatten)) static void Add(               \
+        Acc* acc, const T* x, std::size_t n) noexcept {                     \
+      G::Add(acc, x, n);                                                    \
+    }                                                                       \
+    __attribute__((target(Target), flatten)) static void AddAbs(            \
+        Norm* acc, const T* x, std::size_t n) noexcept {                    \
+      G::AddAbs(acc, x, n);                                                 \
+    }                                                                       \
+  };
+
+S21_MATRIX_REDUCTIONS_FOR(Avx2Reductions, "avx2")
+S21_MATRIX_REDUCTIONS_FOR(Avx512Reductions, "avx512f,avx512bw")
+
+#undef S21_MATRIX_REDUCTIONS_FOR
+
+#endif  // S21_MATRIX_SIMD_X86
+
+// One set of reduction kernels for a given element type and ISA.
+template <typename T>
+struct ReductionKernels {
+  using Acc = SumOf<T>;
+  using Norm = NormOf<T>;
+
+  Acc (*sum)(const T* x, std::size_t n) noexcept;
+  Norm (*sum_abs)(const T* x, std::size_t n) noexcept;
+  Norm (*sum_squares)(const T* x, std::size_t n) noexcept;
+  Acc (*dot)(const T* x, const T* y, std::size_t n) noexcept;
+  T (*min)(const T* x, std::size_t n) noexcept;
+  T (*max)(const T* x, std::size_t n) noexcept;
+  void (*add)(Acc* acc, const T* x, std::size_t n) noexcept;
+  void (*add_abs)(Norm* acc, const T* x, std::size_t n) noexcept;
+};
+
+template <typename T, template <typename> class K>
+const ReductionKernels<T>& MakeReductionKernels() noexcept {
+  static const ReductionKernels<T> kernels{
+      K<T>::Sum, K<T>::SumAbs, K<T>::SumSquares, K<T>::Dot,
+      K<T>::Min, K<T>::Max,    K<T>::Add,        K<T>::AddAbs};
+  return kernels;
+}
+
+template <typename T>
+const ReductionKernels<T>& ReductionKernelsFor(simd::Isa isa) noexcept {
+#if defined(S21_MATRIX_SIMD_X86)
+  if constexpr (simd::kIsVectorizable<T>) {
+    switch (isa) {
+      case simd::Isa::kAvx512:
+        return MakeReductionKernels<T, Avx512Reductions>();
+      case simd::Isa::kAvx2:
+        return MakeReductionKernels<T, Avx2Reductions>();
+      default:
+        break;
+    }
+  }
+#else
+  (void)isa;
+#endif
+  return MakeReductionKernels<T, GenericReductions>();
+}
+
+// The kernels of the currently active instruction set.
+template <typename T>
+const ReductionKernels<T>& Reductions() noexcept {
+  return ReductionKernelsFor<T>(simd::ActiveIsa());
+}
+
+// Calls run(row, col, n) on every piece of a rows x cols block, a whole
+// dense block being a single row, and returns the results in order.
+template <typename R, typename F>
+std::vector<R> ReducePieces(std::size_t rows, std::size_t cols, bool dense,
+                            F&& run) {
+  if (dense) {
+    cols *= rows;
+    rows = 1;
+  }
+  std::size_t pieces = (cols + kReducePiece - 1) / kReducePiece;
+  std::vector<R> parts(rows * pieces);
+  s21::ParallelFor(
+      parts.size(), std::min(cols, kReducePiece),
+      [&](std::size_t begin, std::size_t end) {
+        for (std::size_t p = begin; p < end; ++p) {
+          std::size_t r = p / pieces, c = p % pieces * kReducePiece;
+          parts[p] = run(r, c, std::min(kReducePiece, cols - c));
+        }
+      });
+  return parts;
+}
+
+// the pairwise sum of run() over the pieces
+template <typename R, typename F>
+R SumPieces(std::size_t rows, std::size_t cols, bool dense, F&& run) {
+  if (!rows || !cols) return R{};
+  if ((dense || rows == 1) && rows * cols <= kReducePiece) {
+    return run(0, 0, rows * cols);
+  }
+  std::vector<R> parts = ReducePieces<R>(rows, cols, dense, run);
+  return PairwiseSum<R>(parts.size(),
+                        [&parts](std::size_t i) { return parts[i]; });
+}
+
+// the extremum of run() over the pieces of a nonempty block
+template <typename T, typename F, typename Pick>
+T PickPieces(std::size_t rows, std::size_t cols, bool dense, F&& run,
+             Pick pick) {
+  if ((dense || rows == 1) && rows * cols <= kReducePiece) {
+    return run(0, 0, rows * cols);
+  }
+  std::vector<T> parts = ReducePieces<T>(rows, cols, dense, run);
+  T best = parts[0];
+  for (const T& part : parts) best = pick(part, best);
+  return best;
+}
+
+// out[c] = the sum over the rows of column c, with add(acc, row, n)
+// adding n elements of a row into acc. Blocks of rows are summed into a
+// row of partial sums, which merge pairwise; threads take whole columns.
+template <typename R, typename T, typename Add>
+void SumColumns(std::size_t rows, std::size_t cols, const T* x,
+                std::size_t ld, Add add, R* out) {
+  s21::ParallelFor(
+      cols, rows,
+      [&](std::size_t begin, std::size_t end) {
+        std::size_t width = end - begin;
+        std::vector<std::vector<R>> pending;
+        std::size_t depth = 0;
+        std::vector<R> block(width);
+        for (std::size_t r = 0, count = 1; r < rows; ++count) {
+          std::fill(block.begin(), block.end(), R{});
+          for (std::size_t last = std::min(rows, r + kReduceBlock); r < last;
+               ++r) {
+            add(block.data(), x + r * ld + begin, width);
+          }
+          for (std::size_t carry = count; !(carry & 1); carry >>= 1) {
+            const std::vector<R>& lower = pending[--depth];
+            for (std::size_t c = 0; c < width; ++c) {
+              block[c] = lower[c] + block[c];
+            }
+          }
+          if (pending.size() == depth) pending.emplace_back(width);
+          std::swap(pending[depth++], block);
+        }
+        std::fill(out + begin, out + end, R{});
+        while (depth) {
+          const std::vector<R>& lower = pending[--depth];
+          for (std::size_t c = 0; c < width; ++c) {
+            out[begin + c] = lower[c] + out[begin + c];
+          }
+        }
+      },
+      kReduceLanes);
+}
+
+}  // namespace detail
+}  // namespace s21
+
+#endif  // S21_MATRIXPLUSPLUS_SRC_S21_MATRIX_REDUCE_H_
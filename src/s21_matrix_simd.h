@@ -0,0 +1,526 @@
+#ifndef S21_MATRIXPLUSPLUS_SRC_S21_MATRIX_SIMD_H_
+#define S21_MATRIXPLUSPLUS_SRC_S21_MATRIX_SIMD_H_
+
+#include <atomic>
+#include <cmath>
+#include <cstddef>
+#include <stdexcept>
+#include <string>
+#include <type_traits>
+
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+#define S21_MATRIX_SIMD_X86 1
+#include <immintrin.h>
+#endif
+
+// Element-wise kernels behind SumMatrix, SubMatrix, MulNumber and EqMatrix.
+// Every kernel has a portable scalar version; on x86 there are SSE2, AVX2
+// and AVX-512 versions compiled with per-function target attributes, so the
+// header needs no -m flags. The instruction set is detected via cpuid once,
+// on first use, and can be lowered with SetActiveIsa (e.g. in tests).
+namespace s21 {
+namespace simd {
+
+enum class Isa { kScalar = 0, kSse2, kAvx2, kAvx512 };
+
+inline const char* IsaName(Isa isa) noexcept {
+  switch (isa) {
+    case Isa::kSse2:
+      return "sse2";
+    case Isa::kAvx2:
+      return "avx2";
+    case Isa::kAvx512:
+      return "avx512";
+    default:
+      return "scalar";
+  }
+}
+
+// The best instruction set the running CPU supports.
+inline Isa DetectIsa() noexcept {
+#if defined(S21_MATRIX_SIMD_X86)
+  __builtin_cpu_init();
+  if (__builtin_cpu_supports("avx512f") && __builtin_cpu_supports("avx512bw")) {
+    return Isa::kAvx512;
+  }
+  if (__builtin_cpu_supports("avx2")) {
+    return Isa::kAvx2;
+  }
+  if (__builtin_cpu_supports("sse2")) {
+    return Isa::kSse2;
+  }
+#endif
+  return Isa::kScalar;
+}
+
+inline bool IsSupported(Isa isa) noexcept {
+  static const Isa detected = DetectIsa();
+  return isa <= detected;
+}
+
+namespace detail {
+
+inline std::atomic<Isa>& ActiveIsaStorage() noexcept {
+  static std::atomic<Isa> active{DetectIsa()};
+  return active;
+}
+
+}  // namespace detail
+
+inline Isa ActiveIsa() noexcept {
+  return detail::ActiveIsaStorage().load(std::memory_order_relaxed);
+}
+
+inline void SetActiveIsa(Isa isa) {
+  if (!IsSupported(isa)) {
+    throw std::invalid_argument(std::string("unsupported instruction set: ") +
+                                IsaName(isa));
+  }
+  detail::ActiveIsaStorage().store(isa, std::memory_order_relaxed);
+}
+
+// long double has no vector registers and bool must not wrap around,
+// everything else goes through the vector kernels.
+template <typename T>
+inline constexpr bool kIsVectorizable =
+    std::is_same_v<T, float> || std::is_same_v<T, double> ||
+    (std::is_integral_v<T> && !std::is_same_v<T, bool>);
+
+namespace detail {
+
+// scalar
+
+template <typename T>
+void SumScalar(T* dst, const T* src, std::size_t n) noexcept {
+  for (std::size_t i = 0; i < n; ++i) dst[i] += src[i];
+}
+
+template <typename T>
+void SubScalar(T* dst, const T* src, std::size_t n) noexcept {
+  for (std::size_t i = 0; i < n; ++i) dst[i] -= src[i];
+}
+
+// Floating types are scaled in their own precision; integers still need
+// the wide intermediate to honour fractional factors, so they stay scalar.
+template <typename T>
+void ScaleScalar(T* dst, std::size_t n, long double num) noexcept {
+  if constexpr (std::is_floating_point_v<T>) {
+    const T factor = static_cast<T>(num);
+    for (std::size_t i = 0; i < n; ++i) dst[i] *= factor;
+  } else {
+    for (std::size_t i = 0; i < n; ++i) dst[i] *= num;
+  }
+}
+
+template <typename T>
+bool EqualScalar(const T* lhs, const T* rhs, std::size_t n,
+                 double eps) noexcept {
+  for (std::size_t i = 0; i < n; ++i) {
+    if (std::fabs(lhs[i] - rhs[i]) > eps) return false;
+  }
+  return true;
+}
+
+// The float threshold that makes |a - b| > t equivalent to the scalar
+// comparison of the float difference against a double epsilon.
+inline float FloatThreshold(double eps) noexcept {
+  float threshold = static_cast<float>(eps);
+  if (static_cast<double>(threshold) > eps) {
+    threshold = std::nextafter(threshold, 0.0f);
+  }
+  return threshold;
+}
+
+#if defined(S21_MATRIX_SIMD_X86)
+
+// SSE2
+
+template <typename T>
+__attribute__((target("sse2"))) void SumSse2(T* dst, const T* src,
+                                             std::size_t n) noexcept {
+  constexpr std::size_t kStep = 16 / sizeof(T);
+  std::size_t i = 0;
+  for (; i + kStep <= n; i += kStep) {
+    if constexpr (std::is_same_v<T, float>) {
+      _mm_storeu_ps(dst + i,
+                    _mm_add_ps(_mm_loadu_ps(dst + i), _mm_loadu_ps(src + i)));
+    } else if constexpr (std::is_same_v<T, double>) {
+      _mm_storeu_pd(dst + i,
+                    _mm_add_pd(_mm_loadu_pd(dst + i), _mm_loadu_pd(src + i)));
+    } else {
+      __m128i a = _mm_loadu_si128(reinterpret_cast<const __m128i*>(dst + i));
+      __m128i b = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src + i));
+      __m128i r;
+      if constexpr (sizeof(T) == 1) r = _mm_add_epi8(a, b);
+      if constexpr (sizeof(T) == 2) r = _mm_add_epi16(a, b);
+      if constexpr (sizeof(T) == 4) r = _mm_add_epi32(a, b);
+      if constexpr (sizeof(T) == 8) r = _mm_add_epi64(a, b);
+      _mm_storeu_si128(reinterpret_cast<__m128i*>(dst + i), r);
+    }
+  }
+  SumScalar(dst + i, src + i, n - i);
+}
+
+template <typename T>
+__attribute__((target("sse2"))) void SubSse2(T* dst, const T* src,
+                                             std::size_t n) noexcept {
+  constexpr std::size_t kStep = 16 / sizeof(T);
+  std::size_t i = 0;
+  for (; i + kStep <= n; i += kStep) {
+    if constexpr (std::is_same_v<T, float>) {
+      _mm_storeu_ps(dst + i,
+                    _mm_sub_ps(_mm_loadu_ps(dst + i), _mm_loadu_ps(src + i)));
+    } else if constexpr (std::is_same_v<T, double>) {
+      _mm_storeu_pd(dst + i,
+                    _mm_sub_pd(_mm_loadu_pd(dst + i), _mm_loadu_pd(src + i)));
+    } else {
+      __m128i a = _mm_loadu_si128(reinterpret_cast<const __m128i*>(dst + i));
+      __m128i b = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src + i));
+      __m128i r;
+      if constexpr (sizeof(T) == 1) r = _mm_sub_epi8(a, b);
+      if constexpr (sizeof(T) == 2) r = _mm_sub_epi16(a, b);
+      if constexpr (sizeof(T) == 4) r = _mm_sub_epi32(a, b);
+      if constexpr (sizeof(T) == 8) r = _mm_sub_epi64(a, b);
+      _mm_storeu_si128(reinterpret_cast<__m128i*>(dst + i), r);
+    }
+  }
+  SubScalar(dst + i, src + i, n - i);
+}
+
+template <typename T>
+__attribute__((target("sse2"))) void ScaleSse2(T* dst, std::size_t n,
+                                               long double num) noexcept {
+  constexpr std::size_t kStep = 16 / sizeof(T);
+  std::size_t i = 0;
+  if constexpr (std::is_same_v<T, float>) {
+    const __m128 factor = _mm_set1_ps(static_cast<float>(num));
+    for (; i + kStep <= n; i += kStep) {
+      _mm_storeu_ps(dst + i, _mm_mul_ps(_mm_loadu_ps(dst + i), factor));
+    }
+  } else if constexpr (std::is_same_v<T, double>) {
+    const __m128d factor = _mm_set1_pd(static_cast<double>(num));
+    for (; i + kStep <= n; i += kStep) {
+      _mm_storeu_pd(dst + i, _mm_mul_pd(_mm_loadu_pd(dst + i), factor));
+    }
+  }
+  ScaleScalar(dst + i, n - i, num);
+}
+
+template <typename T>
+__attribute__((target("sse2"))) bool EqualSse2(const T* lhs, const T* rhs,
+                                               std::size_t n,
+                                               double eps) noexcept {
+  constexpr std::size_t kStep = 16 / sizeof(T);
+  std::size_t i = 0;
+  if constexpr (std::is_same_v<T, float>) {
+    const __m128 sign = _mm_set1_ps(-0.0f);
+    const __m128 threshold = _mm_set1_ps(FloatThreshold(eps));
+    for (; i + kStep <= n; i += kStep) {
+      __m128 diff = _mm_sub_ps(_mm_loadu_ps(lhs + i), _mm_loadu_ps(rhs + i));
+      // cmpgt is an ordered comparison, so NaN differences pass like fabs
+      if (_mm_movemask_ps(_mm_cmpgt_ps(_mm_andnot_ps(sign, diff), threshold))) {
+        return false;
+      }
+    }
+  } else if constexpr (std::is_same_v<T, double>) {
+    const __m128d sign = _mm_set1_pd(-0.0);
+    const __m128d threshold = _mm_set1_pd(eps);
+    for (; i + kStep <= n; i += kStep) {
+      __m128d diff = _mm_sub_pd(_mm_loadu_pd(lhs + i), _mm_loadu_pd(rhs + i));
+      if (_mm_movemask_pd(_mm_cmpgt_pd(_mm_andnot_pd(sign, diff), threshold))) {
+        return false;
+      }
+    }
+  } else {
+    // integers are equal exactly when all of their bytes are
+    for (; i + kStep <= n; i += kStep) {
+      __m128i a = _mm_loadu_si128(reinterpret_cast<const __m128i*>(lhs + i));
+      __m128i b = _mm_loadu_si128(reinterpret_cast<const __m128i*>(rhs + i));
+      if (_mm_movemask_epi8(_mm_cmpeq_epi8(a, b)) != 0xFFFF) return false;
+    }
+  }
+  return EqualScalar(lhs + i, rhs + i, n - i, eps);
+}
+
+// AVX2
+
+template <typename T>
+__attribute__((target("avx2"))) void SumAvx2(T* dst, const T* src,
+                                             std::size_t n) noexcept {
+  constexpr std::size_t kStep = 32 / sizeof(T);
+  std::size_t i = 0;
+  for (; i + kStep <= n; i += kStep) {
+    if constexpr (std::is_same_v<T, float>) {
+      _mm256_storeu_ps(dst + i, _mm256_add_ps(_mm256_loadu_ps(dst + i),
+                                              _mm256_loadu_ps(src + i)));
+    } else if constexpr (std::is_same_v<T, double>) {
+      _mm256_storeu_pd(dst + i, _mm256_add_pd(_mm256_loadu_pd(dst + i),
+                                              _mm256_loadu_pd(src + i)));
+    } else {
+      __m256i a =
+          _mm256_loadu_si256(reinterpret_cast<const __m256i*>(dst + i));
+      __m256i b =
+          _mm256_loadu_si256(reinterpret_cast<const __m256i*>(src + i));
+      __m256i r;
+      if constexpr (sizeof(T) == 1) r = _mm256_add_epi8(a, b);
+      if constexpr (sizeof(T) == 2) r = _mm256_add_epi16(a, b);
+      if constexpr (sizeof(T) == 4) r = _mm256_add_epi32(a, b);
+      if constexpr (sizeof(T) == 8) r = _mm256_add_epi64(a, b);
+      _mm256_storeu_si256(reinterpret_cast<__m256i*>(dst + i), r);
+    }
+  }
+  SumScalar(dst + i, src + i, n - i);
+}
+
+template <typename T>
+__attribute__((target("avx2"))) void SubAvx2(T* dst, const T* src,
+                                             std::size_t n) noexcept {
+  constexpr std::size_t kStep = 32 / sizeof(T);
+  std::size_t i = 0;
+  for (; i + kStep <= n; i += kStep) {
+    if constexpr (std::is_same_v<T, float>) {
+      _mm256_storeu_ps(dst + i, _mm256_sub_ps(_mm256_loadu_ps(dst + i),
+                                              _mm256_loadu_ps(src + i)));
+    } else if constexpr (std::is_same_v<T, double>) {
+      _mm256_storeu_pd(dst + i, _mm256_sub_pd(_mm256_loadu_pd(dst + i),
+                                              _mm256_loadu_pd(src + i)));
+    } else {
+      __m256i a =
+          _mm256_loadu_si256(reinterpret_cast<const __m256i*>(dst + i));
+      __m256i b =
+          _mm256_loadu_si256(reinterpret_cast<const __m256i*>(src + i));
+      __m256i r;
+      if constexpr (sizeof(T) == 1) r = _mm256_sub_epi8(a, b);
+      if constexpr (sizeof(T) == 2) r = _mm256_sub_epi16(a, b);
+      if constexpr (sizeof(T) == 4) r = _mm256_sub_epi32(a, b);
+      if constexpr (sizeof(T) == 8) r = _mm256_sub_epi64(a, b);
+      _mm256_storeu_si256(reinterpret_cast<__m256i*>(dst + i), r);
+    }
+  }
+  SubScalar(dst + i, src + i, n - i);
+}
+
+template <typename T>
+__attribute__((target("avx2"))) void ScaleAvx2(T* dst, std::size_t n,
+                                               long double num) noexcept {
+  constexpr std::size_t kStep = 32 / sizeof(T);
+  std::size_t i = 0;
+  if constexpr (std::is_same_v<T, float>) {
+    const __m256 factor = _mm256_set1_ps(static_cast<float>(num));
+    for (; i + kStep <= n; i += kStep) {
+      _mm256_storeu_ps(dst + i,
+                       _mm256_mul_ps(_mm256_loadu_ps(dst + i), factor));
+    }
+  } else if constexpr (std::is_same_v<T, double>) {
+    const __m256d factor = _mm256_set1_pd(static_cast<double>(num));
+    for (; i + kStep <= n; i += kStep) {
+      _mm256_storeu_pd(dst + i,
+                       _mm256_mul_pd(_mm256_loadu_pd(dst + i), factor));
+    }
+  }
+  ScaleScalar(dst + i, n - i, num);
+}
+
+template <typename T>
+__attribute__((target("avx2"))) bool EqualAvx2(const T* lhs, const T* rhs,
+                                               std::size_t n,
+                                               double eps) noexcept {
+  constexpr std::size_t kStep = 32 / sizeof(T);
+  std::size_t i = 0;
+  if constexpr (std::is_same_v<T, float>) {
+    const __m256 sign = _mm256_set1_ps(-0.0f);
+    const __m256 threshold = _mm256_set1_ps(FloatThreshold(eps));
+    for (; i + kStep <= n; i += kStep) {
+      __m256 diff =
+          _mm256_sub_ps(_mm256_loadu_ps(lhs + i), _mm256_loadu_ps(rhs + i));
+      __m256 gt =
+          _mm256_cmp_ps(_mm256_andnot_ps(sign, diff), threshold, _CMP_GT_OQ);
+      if (_mm256_movemask_ps(gt)) return false;
+    }
+  } else if constexpr (std::is_same_v<T, double>) {
+    const __m256d sign = _mm256_set1_pd(-0.0);
+    const __m256d threshold = _mm256_set1_pd(eps);
+    for (; i + kStep <= n; i += kStep) {
+      __m256d diff =
+          _mm256_sub_pd(_mm256_loadu_pd(lhs + i), _mm256_loadu_pd(rhs + i));
+      __m256d gt =
+          _mm256_cmp_pd(_mm256_andnot_pd(sign, diff), threshold, _CMP_GT_OQ);
+      if (_mm256_movemask_pd(gt)) return false;
+    }
+  } else {
+    for (; i + kStep <= n; i += kStep) {
+      __m256i a =
+          _mm256_loadu_si256(reinterpret_cast<const __m256i*>(lhs + i));
+      __m256i b =
+          _mm256_loadu_si256(reinterpret_cast<const __m256i*>(rhs + i));
+      if (_mm256_movemask_epi8(_mm256_cmpeq_epi8(a, b)) != -1) return false;
+    }
+  }
+  return EqualScalar(lhs + i, rhs + i, n - i, eps);
+}
+
+// AVX-512
+
+template <typename T>
+__attribute__((target("avx512f,avx512bw"))) void SumAvx512(
+    T* dst, const T* src, std::size_t n) noexcept {
+  constexpr std::size_t kStep = 64 / sizeof(T);
+  std::size_t i = 0;
+  for (; i + kStep <= n; i += kStep) {
+    if constexpr (std::is_same_v<T, float>) {
+      _mm512_storeu_ps(dst + i, _mm512_add_ps(_mm512_loadu_ps(dst + i),
+                                              _mm512_loadu_ps(src + i)));
+    } else if constexpr (std::is_same_v<T, double>) {
+      _mm512_storeu_pd(dst + i, _mm512_add_pd(_mm512_loadu_pd(dst + i),
+                                              _mm512_loadu_pd(src + i)));
+    } else {
+      __m512i a = _mm512_loadu_si512(dst + i);
+      __m512i b = _mm512_loadu_si512(src + i);
+      __m512i r;
+      if constexpr (sizeof(T) == 1) r = _mm512_add_epi8(a, b);
+      if constexpr (sizeof(T) == 2) r = _mm512_add_epi16(a, b);
+      if constexpr (sizeof(T) == 4) r = _mm512_add_epi32(a, b);
+      if constexpr (sizeof(T) == 8) r = _mm512_add_epi64(a, b);
+      _mm512_storeu_si512(dst + i, r);
+    }
+  }
+  SumScalar(dst + i, src + i, n - i);
+}
+
+template <typename T>
+__attribute__((target("avx512f,avx512bw"))) void SubAvx512(
+    T* dst, const T* src, std::size_t n) noexcept {
+  constexpr std::size_t kStep = 64 / sizeof(T);
+  std::size_t i = 0;
+  for (; i + kStep <= n; i += kStep) {
+    if constexpr (std::is_same_v<T, float>) {
+      _mm512_storeu_ps(dst + i, _mm512_sub_ps(_mm512_loadu_ps(dst + i),
+                                              _mm512_loadu_ps(src + i)));
+    } else if constexpr (std::is_same_v<T, double>) {
+      _mm512_storeu_pd(dst + i, _mm512_sub_pd(_mm512_loadu_pd(dst + i),
+                                              _mm512_loadu_pd(src + i)));
+    } else {
+      __m512i a = _mm512_loadu_si512(dst + i);
+      __m512i b = _mm512_loadu_si512(src + i);
+      __m512i r;
+      if constexpr (sizeof(T) == 1) r = _mm512_sub_epi8(a, b);
+      if constexpr (sizeof(T) == 2) r = _mm512_sub_epi16(a, b);
+      if constexpr (sizeof(T) == 4) r = _mm512_sub_epi32(a, b);
+      if constexpr (sizeof(T) == 8) r = _mm512_sub_epi64(a, b);
+      _mm512_storeu_si512(dst + i, r);
+    }
+  }
+  SubScalar(dst + i, src + i, n - i);
+}
+
+template <typename T>
+__attribute__((target("avx512f,avx512bw"))) void ScaleAvx512(
+    T* dst, std::size_t n, long double num) noexcept {
+  constexpr std::size_t kStep = 64 / sizeof(T);
+  std::size_t i = 0;
+  if constexpr (std::is_same_v<T, float>) {
+    const __m512 factor = _mm512_set1_ps(static_cast<float>(num));
+    for (; i + kStep <= n; i += kStep) {
+      _mm512_storeu_ps(dst + i,
+                       _mm512_mul_ps(_mm512_loadu_ps(dst + i), factor));
+    }
+  } else if constexpr (std::is_same_v<T, double>) {
+    const __m512d factor = _mm512_set1_pd(static_cast<double>(num));
+    for (; i + kStep <= n; i += kStep) {
+      _mm512_storeu_pd(dst + i,
+                       _mm512_mul_pd(_mm512_loadu_pd(dst + i), factor));
+    }
+  }
+  ScaleScalar(dst + i, n - i, num);
+}
+
+template <typename T>
+__attribute__((target("avx512f,avx512bw"))) bool EqualAvx512(
+    const T* lhs, const T* rhs, std::size_t n, double eps) noexcept {
+  constexpr std::size_t kStep = 64 / sizeof(T);
+  std::size_t i = 0;
+  if constexpr (std::is_same_v<T, float>) {
+    const __m512 threshold = _mm512_set1_ps(FloatThreshold(eps));
+    for (; i + kStep <= n; i += kStep) {
+      __m512 diff =
+          _mm512_sub_ps(_mm512_loadu_ps(lhs + i), _mm512_loadu_ps(rhs + i));
+      if (_mm512_cmp_ps_mask(_mm512_abs_ps(diff), threshold, _CMP_GT_OQ)) {
+        return false;
+      }
+    }
+  } else if constexpr (std::is_same_v<T, double>) {
+    const __m512d threshold = _mm512_set1_pd(eps);
+    for (; i + kStep <= n; i += kStep) {
+      __m512d diff =
+          _mm512_sub_pd(_mm512_loadu_pd(lhs + i), _mm512_loadu_pd(rhs + i));
+      if (_mm512_cmp_pd_mask(_mm512_abs_pd(diff), threshold, _CMP_GT_OQ)) {
+        return false;
+      }
+    }
+  } else {
+    for (; i + kStep <= n; i += kStep) {
+      __m512i a = _mm512_loadu_si512(lhs + i);
+      __m512i b = _mm512_loadu_si512(rhs + i);
+      if (_mm512_cmpneq_epi8_mask(a, b)) return false;
+    }
+  }
+  return EqualScalar(lhs + i, rhs + i, n - i, eps);
+}
+
+#endif  // S21_MATRIX_SIMD_X86
+
+}  // namespace detail
+
+// One set of element-wise kernels for a given element type and ISA.
+template <typename T>
+struct ElementwiseKernels {
+  void (*sum)(T* dst, const T* src, std::size_t n) noexcept;
+  void (*sub)(T* dst, const T* src, std::size_t n) noexcept;
+  void (*scale)(T* dst, std::size_t n, long double num) noexcept;
+  bool (*equal)(const T* lhs, const T* rhs, std::size_t n,
+                double eps) noexcept;
+};
+
+template <typename T>
+const ElementwiseKernels<T>& KernelsFor(Isa isa) noexcept {
+  static const ElementwiseKernels<T> scalar{
+      detail::SumScalar<T>, detail::SubScalar<T>, detail::ScaleScalar<T>,
+      detail::EqualScalar<T>};
+#if defined(S21_MATRIX_SIMD_X86)
+  if constexpr (kIsVectorizable<T>) {
+    static const ElementwiseKernels<T> sse2{
+        detail::SumSse2<T>, detail::SubSse2<T>, detail::ScaleSse2<T>,
+        detail::EqualSse2<T>};
+    static const ElementwiseKernels<T> avx2{
+        detail::SumAvx2<T>, detail::SubAvx2<T>, detail::ScaleAvx2<T>,
+        detail::EqualAvx2<T>};
+    static const ElementwiseKernels<T> avx512{
+        detail::SumAvx512<T>, detail::SubAvx512<T>, detail::ScaleAvx512<T>,
+        detail::EqualAvx512<T>};
+    switch (isa) {
+      case Isa::kAvx512:
+        return avx512;
+      case Isa::kAvx2:
+        return avx2;
+      case Isa::kSse2:
+        return sse2;
+      default:
+        break;
+    }
+  }
+#else
+  (void)isa;
+#endif
+  return scalar;
+}
+
+// The kernels of the currently active instruction set.
+template <typename T>
+const ElementwiseKernels<T>& Kernels() noexcept {
+  return KernelsFor<T>(ActiveIsa());
+}
+
+}  // namespace simd
+}  // namespace s21
+
+#endif  // S21_MATRIXPLUSPLUS_SRC_S21_MATRIX_SIMD_H_
@@ -0,0 +1,426 @@
+#ifndef S21_MATRIXPLUSPLUS_SRC_S21_MATRIX_SPARSE_H_
+#define S21_MATRIXPLUSPLUS_SRC_S21_MATRIX_SPARSE_H_
+
+#include <algorithm>
+#include <cstddef>
+#include <memory_resource>
+#include <stdexcept>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+#include "s21_matrix_oop.h"
+#include "s21_matrix_thread_pool.h"
+
+namespace s21 {
+
+// Compressed sparse row (kCsr) or column (kCsc) storage.
+enum class SparseLayout { kCsr, kCsc };
+
+// an (row, col, value) entry for building sparse matrices
+template <typename T>
+struct Triplet {
+  std::size_t row;
+  std::size_t col;
+  T value;
+};
+
+namespace detail {
+
+// Along the major dimension (rows for CSR, columns for CSC) a compressed
+// matrix is a list of sparse vectors: vector i holds the minor indices
+// indices[offsets[i] .. offsets[i + 1]) in increasing order, with their
+// values at the same positions.
+template <typename T>
+struct CompressedStorage {
+  std::pmr::vector<std::size_t> offsets;
+  std::pmr::vector<std::size_t> indices;
+  std::pmr::vector<T> values;
+
+  explicit CompressedStorage(std::pmr::memory_resource* resource)
+      : offsets(resource), indices(resource), values(resource) {}
+
+  CompressedStorage(const CompressedStorage& other,
+                    std::pmr::memory_resource* resource)
+      : offsets(other.offsets, resource),
+        indices(other.indices, resource),
+        values(other.values, resource) {}
+};
+
+// The same entries compressed along the other dimension: a counting sort
+// by minor index that keeps the major indices in order.
+template <typename T>
+CompressedStorage<T> Recompress(const CompressedStorage<T>& src,
+                                std::size_t major, std::size_t minor) {
+  CompressedStorage<T> dst(src.values.get_allocator().resource());
+  std::size_t nnz = src.values.size();
+  dst.offsets.assign(minor + 1, 0);
+  dst.indices.resize(nnz);
+  dst.values.resize(nnz);
+  for (std::size_t k = 0; k < nnz; ++k) ++dst.offsets[src.indices[k] + 1];
+  for (std::size_t j = 0; j < minor; ++j) {
+    dst.offsets[j + 1] += dst.offsets[j];
+  }
+  std::pmr::vector<std::size_t> next(dst.offsets.begin(),
+                                     dst.offsets.end() - 1,
+                                     src.values.get_allocator().resource());
+  for (std::size_t i = 0; i < major; ++i) {
+    for (std::size_t k = src.offsets[i]; k < src.offsets[i + 1]; ++k) {
+      std::size_t pos = next[src.indices[k]]++;
+      dst.indices[pos] = i;
+      dst.values[pos] = src.values[k];
+    }
+  }
+  return dst;
+}
+
+}  // namespace detail
+
+}  // namespace s21
+
+// A sparse companion of S21Matrix: only nonzero elements are stored, so
+// memory and the cost of every operation scale with the number of
+// nonzeros rather than with rows * cols. CSR is the default; it
+// multiplies row by row in parallel. CSC suits column access and
+// building a transpose, and converts to CSR in O(nnz).
+// Exact zeros produced by a conversion or a sum are not stored.
+template <typename T, s21::SparseLayout L = s21::SparseLayout::kCsr,
+          typename = typename std::enable_if<std::is_arithmetic<T>::value,
+                                             T>::type>
+class S21SparseMatrix {
+ public:
+  using value_type = T;
+  using size_type = std::size_t;
+  using allocator_type = std::pmr::polymorphic_allocator<T>;
+  static constexpr s21::SparseLayout kLayout = L;
+  static constexpr bool kIsCsr = L == s21::SparseLayout::kCsr;
+
+ public:
+  // an all-zero rows x cols matrix
+  explicit S21SparseMatrix(size_type rows = 0, size_type cols = 0,
+                           const allocator_type& alloc = {})
+      : _rows(rows), _cols(cols), _storage(alloc.resource()) {
+    _storage.offsets.assign(Major() + 1, 0);
+  }
+
+  // the nonzero elements of a dense matrix or view
+  explicit S21SparseMatrix(const S21MatrixView<const T>& dense,
+                           const allocator_type& alloc = {})
+      : S21SparseMatrix(dense.GetRows(), dense.GetCols(), alloc) {
+    for (size_type i = 0; i < Major(); ++i) {
+      for (size_type j = 0; j < Minor(); ++j) {
+        T value = kIsCsr ? dense.Eval(i, j) : dense.Eval(j, i);
+        if (value != T{}) {
+          _storage.indices.push_back(j);
+          _storage.values.push_back(value);
+        }
+      }
+      _storage.offsets[i + 1] = _storage.values.size();
+    }
+  }
+
+  // a copy shares the memory resource of the original
+  S21SparseMatrix(const S21SparseMatrix& other)
+      : S21SparseMatrix(other, other.GetAllocator()) {}
+
+  S21SparseMatrix(const S21SparseMatrix& other, const allocator_type& alloc)
+      : _rows(other._rows),
+        _cols(other._cols),
+        _storage(other._storage, alloc.resource()) {}
+
+  S21SparseMatrix(S21SparseMatrix&& other) noexcept = default;
+  S21SparseMatrix& operator=(const S21SparseMatrix& other) = default;
+  S21SparseMatrix& operator=(S21SparseMatrix&& other) = default;
+
+  // Entries may come in any order; duplicates are summed.
+  static S21SparseMatrix FromTriplets(size_type rows, size_type cols,
+                                      std::vector<s21::Triplet<T>> triplets,
+                                      const allocator_type& alloc = {}) {
+    S21SparseMatrix mtx(rows, cols, alloc);
+    for (const auto& t : triplets) {
+      mtx.CheckIndexUpperBound(t.row, rows);
+      mtx.CheckIndexUpperBound(t.col, cols);
+    }
+    auto key = [](const s21::Triplet<T>& t) {
+      return kIsCsr ? std::make_pair(t.row, t.col)
+                    : std::make_pair(t.col, t.row);
+    };
+    std::sort(triplets.begin(), triplets.end(),
+              [&](const auto& a, const auto& b) { return key(a) < key(b); });
+    auto& s = mtx._storage;
+    for (size_type k = 0; k < triplets.size();) {
+      auto current = key(triplets[k]);
+      auto [major, minor] = current;
+      T value = triplets[k].value;
+      while (++k < triplets.size() && key(triplets[k]) == current) {
+        value += triplets[k].value;
+      }
+      if (value != T{}) {
+        s.indices.push_back(minor);
+        s.values.push_back(value);
+        ++s.offsets[major + 1];
+      }
+    }
+    for (size_type i = 0; i < mtx.Major(); ++i) {
+      s.offsets[i + 1] += s.offsets[i];
+    }
+    return mtx;
+  }
+
+  S21Matrix<T> ToDense() const {
+    S21Matrix<T> dense(_rows, _cols, GetAllocator());
+    T* data = dense.Data();
+    size_type stride = dense.GetStride();
+    for (size_type i = 0; i < Major(); ++i) {
+      for (size_type k = Begin(i); k < End(i); ++k) {
+        size_type j = _storage.indices[k];
+        (kIsCsr ? data[i * stride + j] : data[j * stride + i]) =
+            _storage.values[k];
+      }
+    }
+    return dense;
+  }
+
+  S21SparseMatrix<T, s21::SparseLayout::kCsr> ToCsr() const {
+    return ToLayout<s21::SparseLayout::kCsr>();
+  }
+
+  S21SparseMatrix<T, s21::SparseLayout::kCsc> ToCsc() const {
+    return ToLayout<s21::SparseLayout::kCsc>();
+  }
+
+  // The arrays of a matrix in one layout are those of its transpose in the
+  // other, so transposing is one recompression.
+  S21SparseMatrix Transpose() const {
+    using Other = S21SparseMatrix<T, kIsCsr ? s21::SparseLayout::kCsc
+                                            : s21::SparseLayout::kCsr>;
+    Other flipped(_cols, _rows, GetAllocator());
+    flipped._storage = _storage;
+    return flipped.template ToLayout<L>();
+  }
+
+  // main operations
+
+  // y = A * x for dense vectors x (cols elements) and y (rows elements)
+  void MulVector(const T* x, T* y) const {
+    if constexpr (kIsCsr) {
+      s21::ParallelFor(_rows, RowCost(), [&](size_type begin, size_type end) {
+        for (size_type i = begin; i < end; ++i) y[i] = RowDot(i, x);
+      });
+    } else {
+      std::fill(y, y + _rows, T{});
+      for (size_type j = 0; j < _cols; ++j) {
+        const T xj = x[j];
+        for (size_type k = Begin(j); k < End(j); ++k) {
+          y[_storage.indices[k]] += _storage.values[k] * xj;
+        }
+      }
+    }
+  }
+
+  // this (rows x k) * dense (k x n), a dense rows x n result
+  S21Matrix<T> MulMatrix(const S21MatrixView<const T>& dense) const {
+    if (_cols != dense.GetRows()) {
+      std::string errmsg = std::string("this cols (") + std::to_string(_cols) +
+                           std::string(" != other rows (") +
+                           std::to_string(dense.GetRows()) + std::string(")");
+      throw std::logic_error(errmsg);
+    }
+    size_type n = dense.GetCols();
+    S21Matrix<T> res(_rows, n, GetAllocator());
+    T* out = res.Data();
+    size_type ldo = res.GetStride();
+    // each nonzero a(i, j) adds a(i, j) * dense row j to result row i
+    auto axpy = [n](T* dst, T a, const T* src) {
+      for (size_type c = 0; c < n; ++c) dst[c] += a * src[c];
+    };
+    if constexpr (kIsCsr) {
+      s21::ParallelFor(
+          _rows, n * RowCost(),
+          [&](size_type begin, size_type end) {
+            for (size_type i = begin; i < end; ++i) {
+              for (size_type k = Begin(i); k < End(i); ++k) {
+                axpy(out + i * ldo, _storage.values[k],
+                     dense.RowData(_storage.indices[k]));
+              }
+            }
+          });
+    } else {
+      for (size_type j = 0; j < _cols; ++j) {
+        for (size_type k = Begin(j); k < End(j); ++k) {
+          axpy(out + _storage.indices[k] * ldo, _storage.values[k],
+               dense.RowData(j));
+        }
+      }
+    }
+    return res;
+  }
+
+  void SumMatrix(const S21SparseMatrix& other) {
+    Merge(other, [](T lhs, T rhs) { return static_cast<T>(lhs + rhs); });
+  }
+
+  void SubMatrix(const S21SparseMatrix& other) {
+    Merge(other, [](T lhs, T rhs) { return static_cast<T>(lhs - rhs); });
+  }
+
+  void MulNumber(long double num) {
+    for (T& value : _storage.values) {
+      value = s21::detail::ScaleValue(value, num);
+    }
+  }
+
+  // the element at (row, col), found by binary search
+  T At(size_type row, size_type col) const {
+    CheckIndexUpperBound(row, _rows);
+    CheckIndexUpperBound(col, _cols);
+    size_type i = kIsCsr ? row : col, j = kIsCsr ? col : row;
+    auto first = _storage.indices.begin() + Begin(i);
+    auto last = _storage.indices.begin() + End(i);
+    auto it = std::lower_bound(first, last, j);
+    if (it == last || *it != j) return T{};
+    return _storage.values[it - _storage.indices.begin()];
+  }
+
+  // getters
+  size_type GetRows() const noexcept { return _rows; }
+  size_type GetCols() const noexcept { return _cols; }
+  size_type GetNonZeros() const noexcept { return _storage.values.size(); }
+  allocator_type GetAllocator() const noexcept {
+    return allocator_type(_storage.values.get_allocator().resource());
+  }
+
+  // The raw compressed arrays, for interoperability: offsets has one
+  // entry per row (CSR) or column (CSC) plus one.
+  const std::pmr::vector<size_type>& GetOffsets() const noexcept {
+    return _storage.offsets;
+  }
+  const std::pmr::vector<size_type>& GetIndices() const noexcept {
+    return _storage.indices;
+  }
+  const std::pmr::vector<T>& GetValues() const noexcept {
+    return _storage.values;
+  }
+
+  // operators
+
+  S21SparseMatrix operator+(const S21SparseMatrix& other) const {
+    S21SparseMatrix mtx(*this);
+    mtx.SumMatrix(other);
+    return mtx;
+  }
+
+  S21SparseMatrix operator-(const S21SparseMatrix& other) const {
+    S21SparseMatrix mtx(*this);
+    mtx.SubMatrix(other);
+    return mtx;
+  }
+
+  S21SparseMatrix& operator+=(const S21SparseMatrix& other) {
+    SumMatrix(other);
+    return *this;
+  }
+
+  S21SparseMatrix& operator-=(const S21SparseMatrix& other) {
+    SubMatrix(other);
+    return *this;
+  }
+
+  S21SparseMatrix& operator*=(long double num) {
+    MulNumber(num);
+    return *this;
+  }
+
+  S21Matrix<T> operator*(const S21MatrixView<const T>& dense) const {
+    return MulMatrix(dense);
+  }
+
+ private:
+  template <typename, s21::SparseLayout, typename>
+  friend class S21SparseMatrix;
+
+  size_type Major() const noexcept { return kIsCsr ? _rows : _cols; }
+  size_type Minor() const noexcept { return kIsCsr ? _cols : _rows; }
+  size_type Begin(size_type i) const noexcept { return _storage.offsets[i]; }
+  size_type End(size_type i) const noexcept { return _storage.offsets[i + 1]; }
+
+  // the average work of a row
+  size_type RowCost() const noexcept {
+    return GetNonZeros() / std::max<size_type>(_rows, 1) + 1;
+  }
+
+  T RowDot(size_type i, const T* x) const noexcept {
+    T sum{};
+    for (size_type k = Begin(i); k < End(i); ++k) {
+      sum += _storage.values[k] * x[_storage.indices[k]];
+    }
+    return sum;
+  }
+
+  template <s21::SparseLayout M>
+  S21SparseMatrix<T, M> ToLayout() const {
+    S21SparseMatrix<T, M> mtx(_rows, _cols, GetAllocator());
+    if constexpr (M == L) {
+      mtx._storage = _storage;
+    } else {
+      mtx._storage = s21::detail::Recompress(_storage, Major(), Minor());
+    }
+    return mtx;
+  }
+
+  // this = op(this, other) over the union of both sparsity patterns
+  template <typename Op>
+  void Merge(const S21SparseMatrix& other, Op op) {
+    if (_rows != other._rows || _cols != other._cols) {
+      throw std::logic_error(
+          std::string("Size mismatch: this ") +
+          s21::detail::DimString(_rows, _cols) + " != other " +
+          s21::detail::DimString(other._rows, other._cols));
+    }
+    s21::detail::CompressedStorage<T> res(GetAllocator().resource());
+    res.offsets.reserve(Major() + 1);
+    res.indices.reserve(GetNonZeros() + other.GetNonZeros());
+    res.values.reserve(GetNonZeros() + other.GetNonZeros());
+    res.offsets.push_back(0);
+    auto emit = [&](size_type j, T value) {
+      if (value == T{}) return;
+      res.indices.push_back(j);
+      res.values.push_back(value);
+    };
+    const auto& a = _storage;
+    const auto& b = other._storage;
+    for (size_type i = 0; i < Major(); ++i) {
+      size_type p = Begin(i), q = other.Begin(i);
+      while (p < End(i) || q < other.End(i)) {
+        if (q == other.End(i) || (p < End(i) && a.indices[p] < b.indices[q])) {
+          emit(a.indices[p], op(a.values[p], T{}));
+          ++p;
+        } else if (p == End(i) || b.indices[q] < a.indices[p]) {
+          emit(b.indices[q], op(T{}, b.values[q]));
+          ++q;
+        } else {
+          emit(a.indices[p], op(a.values[p], b.values[q]));
+          ++p;
+          ++q;
+        }
+      }
+      res.offsets.push_back(res.values.size());
+    }
+    _storage = std::move(res);
+  }
+
+  void CheckIndexUpperBound(size_type idx, size_type upper) const {
+    if (idx >= upper) {
+      std::string errmsg = "index ";
+      errmsg += std::to_string(idx);
+      errmsg += " >= ";
+      errmsg += std::to_string(upper);
+      throw std::out_of_range(errmsg);
+    }
+  }
+
+  size_type _rows, _cols;
+  s21::detail::CompressedStorage<T> _storage;
+};
+
+#endif  // S21_MATRIXPLUSPLUS_SRC_S21_MATRIX_SPARSE_H_
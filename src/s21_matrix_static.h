@@ -0,0 +1,478 @@
+#ifndef S21_MATRIXPLUSPLUS_SRC_S21_MATRIX_STATIC_H_
+#define S21_MATRIXPLUSPLUS_SRC_S21_MATRIX_STATIC_H_
+
+#include <array>
+#include <cstddef>
+#include <limits>
+#include <stdexcept>
+#include <string>
+#include <type_traits>
+
+#include "s21_matrix_oop.h"
+
+namespace s21 {
+namespace detail {
+
+template <typename W>
+constexpr W StaticAbs(W value) noexcept {
+  return value < 0 ? -value : value;
+}
+
+}  // namespace detail
+}  // namespace s21
+
+// A matrix whose dimensions are template arguments. Elements live inline,
+// nothing is allocated, shapes are checked at compile time, and all loops
+// have constant trip counts, so small sizes are fully unrolled. Results
+// match S21Matrix: the same rounding, tolerance and error messages.
+template <typename T, std::size_t Rows, std::size_t Cols,
+          typename = std::enable_if_t<std::is_arithmetic_v<T>>>
+class S21StaticMatrix {
+ public:
+  using value_type = T;
+  using size_type = std::size_t;
+
+  static_assert(Rows > 0 && Cols > 0, "dimensions must be positive");
+
+ public:
+  constexpr S21StaticMatrix() noexcept = default;
+
+  constexpr explicit S21StaticMatrix(T value) noexcept {
+    for (size_type i = 0; i < kSize; ++i) _data[i] = value;
+  }
+
+  // row-major elements
+  constexpr explicit S21StaticMatrix(
+      const std::array<T, Rows * Cols>& values) noexcept {
+    for (size_type i = 0; i < kSize; ++i) _data[i] = values[i];
+  }
+
+  // a template only so that a braced list never picks it over std::array
+  template <typename M,
+            typename = std::enable_if_t<std::is_same_v<M, S21Matrix<T>>>>
+  explicit S21StaticMatrix(const M& mtx) {
+    if (mtx.GetRows() != Rows || mtx.GetCols() != Cols) {
+      throw std::logic_error(
+          std::string("Size mismatch: this ") +
+          s21::detail::DimString(Rows, Cols) + " != other " +
+          s21::detail::DimString(mtx.GetRows(), mtx.GetCols()));
+    }
+    for (size_type r = 0; r < Rows; ++r) {
+      for (size_type c = 0; c < Cols; ++c) _data[r * Cols + c] = mtx(r, c);
+    }
+  }
+
+  S21Matrix<T> ToMatrix(
+      const typename S21Matrix<T>::allocator_type& alloc = {}) const {
+    S21Matrix<T> mtx(Rows, Cols, alloc);
+    for (size_type r = 0; r < Rows; ++r) {
+      for (size_type c = 0; c < Cols; ++c) mtx(r, c) = _data[r * Cols + c];
+    }
+    return mtx;
+  }
+
+  static constexpr S21StaticMatrix Identity() noexcept {
+    static_assert(Rows == Cols, "the identity matrix is square");
+    S21StaticMatrix mtx;
+    for (size_type i = 0; i < Rows; ++i) mtx._data[i * Cols + i] = T{1};
+    return mtx;
+  }
+
+  // main operations
+
+  // within s21::DefaultTolerance<T>(), like S21Matrix::EqMatrix
+  constexpr bool EqMatrix(const S21StaticMatrix& other) const noexcept {
+    constexpr double eps = s21::DefaultTolerance<T>().eps;
+    for (size_type i = 0; i < kSize; ++i) {
+      auto diff = _data[i] - other._data[i];
+      if (diff > eps || -diff > eps) return false;
+    }
+    return true;
+  }
+
+  constexpr void SumMatrix(const S21StaticMatrix& other) noexcept {
+    for (size_type i = 0; i < kSize; ++i) {
+      _data[i] = static_cast<T>(_data[i] + other._data[i]);
+    }
+  }
+
+  constexpr void SubMatrix(const S21StaticMatrix& other) noexcept {
+    for (size_type i = 0; i < kSize; ++i) {
+      _data[i] = static_cast<T>(_data[i] - other._data[i]);
+    }
+  }
+
+  constexpr void MulNumber(long double num) noexcept {
+    for (size_type i = 0; i < kSize; ++i) {
+      if constexpr (std::is_floating_point_v<T>) {
+        _data[i] *= static_cast<T>(num);
+      } else {
+        _data[i] = static_cast<T>(_data[i] * num);
+      }
+    }
+  }
+
+  // in place, so only by a square matrix
+  constexpr void MulMatrix(
+      const S21StaticMatrix<T, Cols, Cols>& other) noexcept {
+    *this = *this * other;
+  }
+
+  constexpr S21StaticMatrix<T, Cols, Rows> Transpose() const noexcept {
+    S21StaticMatrix<T, Cols, Rows> mtx;
+    for (size_type r = 0; r < Rows; ++r) {
+      for (size_type c = 0; c < Cols; ++c) {
+        mtx._data[c * Rows + r] = _data[r * Cols + c];
+      }
+    }
+    return mtx;
+  }
+
+  constexpr long double Determinant() const noexcept {
+    static_assert(Rows == Cols, "the determinant needs a square matrix");
+    return Det();
+  }
+
+  constexpr S21StaticMatrix CalcComplements() const noexcept {
+    static_assert(Rows == Cols, "complements need a square matrix");
+    S21StaticMatrix mtx;
+    if constexpr (Rows <= kClosedFormSize) {
+      Real adj[kSize]{};
+      Adjugate(adj);
+      for (size_type r = 0; r < Rows; ++r) {
+        for (size_type c = 0; c < Cols; ++c) {
+          mtx._data[r * Cols + c] = static_cast<T>(adj[c * Cols + r]);
+        }
+      }
+    } else {
+      for (size_type r = 0; r < Rows; ++r) {
+        for (size_type c = 0; c < Cols; ++c) {
+          Real minor = MinorMatrix(r, c).Det();
+          mtx._data[r * Cols + c] =
+              static_cast<T>((r + c) % 2 ? -minor : minor);
+        }
+      }
+    }
+    return mtx;
+  }
+
+  constexpr S21StaticMatrix InverseMatrix() const {
+    static_assert(Rows == Cols, "the inverse needs a square matrix");
+    S21StaticMatrix mtx;
+    if constexpr (Rows <= kClosedFormSize) {
+      // the adjugate over the determinant
+      Real adj[kSize]{};
+      Real det = Adjugate(adj);
+      CheckIsNonsingular(det);
+      for (size_type i = 0; i < kSize; ++i) {
+        mtx._data[i] = static_cast<T>(adj[i] / det);
+      }
+    } else {
+      CheckIsNonsingular(Det());
+      // Gauss-Jordan on [A | I]
+      Real a[kSize]{}, x[kSize]{};
+      for (size_type i = 0; i < kSize; ++i) a[i] = _data[i];
+      for (size_type i = 0; i < Rows; ++i) x[i * Cols + i] = 1;
+      for (size_type k = 0; k < Rows; ++k) {
+        size_type pivot = k;
+        for (size_type i = k + 1; i < Rows; ++i) {
+          if (s21::detail::StaticAbs(a[i * Cols + k]) >
+              s21::detail::StaticAbs(a[pivot * Cols + k])) {
+            pivot = i;
+          }
+        }
+        for (size_type j = 0; j < Cols && pivot != k; ++j) {
+          Real tmp = a[k * Cols + j];
+          a[k * Cols + j] = a[pivot * Cols + j];
+          a[pivot * Cols + j] = tmp;
+          tmp = x[k * Cols + j];
+          x[k * Cols + j] = x[pivot * Cols + j];
+          x[pivot * Cols + j] = tmp;
+        }
+        Real diag = a[k * Cols + k];
+        for (size_type j = 0; j < Cols; ++j) {
+          a[k * Cols + j] /= diag;
+          x[k * Cols + j] /= diag;
+        }
+        for (size_type i = 0; i < Rows; ++i) {
+          Real factor = a[i * Cols + k];
+          if (i == k || factor == 0) continue;
+          for (size_type j = 0; j < Cols; ++j) {
+            a[i * Cols + j] -= factor * a[k * Cols + j];
+            x[i * Cols + j] -= factor * x[k * Cols + j];
+          }
+        }
+      }
+      for (size_type i = 0; i < kSize; ++i) mtx._data[i] = static_cast<T>(x[i]);
+    }
+    return mtx;
+  }
+
+  // additional operations
+
+  constexpr S21StaticMatrix<T, Rows - 1, Cols - 1> MinorMatrix(
+      size_type row, size_type col) const noexcept {
+    S21StaticMatrix<T, Rows - 1, Cols - 1> mtx;
+    for (size_type r = 0; r + 1 < Rows; ++r) {
+      for (size_type c = 0; c + 1 < Cols; ++c) {
+        mtx._data[r * (Cols - 1) + c] =
+            _data[(r + (r >= row)) * Cols + c + (c >= col)];
+      }
+    }
+    return mtx;
+  }
+
+  // getters
+  static constexpr size_type GetRows() noexcept { return Rows; }
+  static constexpr size_type GetCols() noexcept { return Cols; }
+
+  // operators
+
+  constexpr bool operator==(const S21StaticMatrix& other) const noexcept {
+    return EqMatrix(other);
+  }
+
+  constexpr S21StaticMatrix operator+(
+      const S21StaticMatrix& other) const noexcept {
+    S21StaticMatrix mtx(*this);
+    mtx.SumMatrix(other);
+    return mtx;
+  }
+
+  constexpr S21StaticMatrix operator-(
+      const S21StaticMatrix& other) const noexcept {
+    S21StaticMatrix mtx(*this);
+    mtx.SubMatrix(other);
+    return mtx;
+  }
+
+  constexpr S21StaticMatrix operator*(long double num) const noexcept {
+    S21StaticMatrix mtx(*this);
+    mtx.MulNumber(num);
+    return mtx;
+  }
+
+  friend constexpr S21StaticMatrix operator*(
+      long double num, const S21StaticMatrix& mtx) noexcept {
+    return mtx * num;
+  }
+
+  template <size_type Other>
+  constexpr S21StaticMatrix<T, Rows, Other> operator*(
+      const S21StaticMatrix<T, Cols, Other>& other) const noexcept {
+    S21StaticMatrix<T, Rows, Other> mtx;
+    for (size_type r = 0; r < Rows; ++r) {
+      // a local row keeps the accumulation in registers
+      T row[Other]{};
+      for (size_type k = 0; k < Cols; ++k) {
+        const T lhs = _data[r * Cols + k];
+        const T* rhs = other._data + k * Other;
+        // Left alone, GCC unrolls this loop completely before the
+        // vectoriser runs and the result stays scalar.
+#if defined(__GNUC__)
+#pragma GCC unroll 1
+#endif
+        for (size_type c = 0; c < Other; ++c) {
+          row[c] = static_cast<T>(row[c] + lhs * rhs[c]);
+        }
+      }
+      for (size_type c = 0; c < Other; ++c) mtx._data[r * Other + c] = row[c];
+    }
+    return mtx;
+  }
+
+  constexpr S21StaticMatrix& operator+=(const S21StaticMatrix& other) noexcept {
+    SumMatrix(other);
+    return *this;
+  }
+
+  constexpr S21StaticMatrix& operator-=(const S21StaticMatrix& other) noexcept {
+    SubMatrix(other);
+    return *this;
+  }
+
+  constexpr S21StaticMatrix& operator*=(long double num) noexcept {
+    MulNumber(num);
+    return *this;
+  }
+
+  constexpr S21StaticMatrix& operator*=(
+      const S21StaticMatrix<T, Cols, Cols>& other) noexcept {
+    MulMatrix(other);
+    return *this;
+  }
+
+  constexpr const T& operator()(size_type row, size_type col) const {
+    CheckIndexUpperBound(row, Rows);
+    CheckIndexUpperBound(col, Cols);
+    return _data[row * Cols + col];
+  }
+
+  constexpr T& operator()(size_type row, size_type col) {
+    CheckIndexUpperBound(row, Rows);
+    CheckIndexUpperBound(col, Cols);
+    return _data[row * Cols + col];
+  }
+
+  // checked at compile time, so free at run time
+  template <size_type Row, size_type Col>
+  constexpr const T& At() const noexcept {
+    static_assert(Row < Rows && Col < Cols, "index out of range");
+    return _data[Row * Cols + Col];
+  }
+
+  template <size_type Row, size_type Col>
+  constexpr T& At() noexcept {
+    static_assert(Row < Rows && Col < Cols, "index out of range");
+    return _data[Row * Cols + Col];
+  }
+
+  friend std::ostream& operator<<(std::ostream& os,
+                                  const S21StaticMatrix& mtx) {
+    os << mtx.ToMatrix();
+    return os;
+  }
+
+ private:
+  template <typename, std::size_t, std::size_t, typename>
+  friend class S21StaticMatrix;
+
+  static constexpr size_type kSize = Rows * Cols;
+  // the largest size inverted through the closed-form adjugate
+  static constexpr size_type kClosedFormSize = 4;
+  static constexpr double kEps = std::numeric_limits<double>::epsilon();
+
+  // elimination runs in the precision S21Matrix factors in
+  using Real = s21::detail::LuReal<T>;
+
+  // Up to 4x4 in closed form, larger matrices by Gaussian elimination
+  // with partial pivoting.
+  constexpr Real Det() const noexcept {
+    if constexpr (Rows == 1) {
+      return _data[0];
+    } else if constexpr (Rows == 2) {
+      return static_cast<Real>(_data[0]) * _data[3] -
+             static_cast<Real>(_data[2]) * _data[1];
+    } else if constexpr (Rows == 3) {
+      Real det = 0;
+      for (size_type c = 0; c < Cols; ++c) {
+        Real minor = MinorMatrix(0, c).Det();
+        det += (c % 2 ? -minor : minor) * _data[c];
+      }
+      return det;
+    } else if constexpr (Rows == 4) {
+      Real s[6]{}, c[6]{};
+      PairMinors(s, c);
+      return s[0] * c[5] - s[1] * c[4] + s[2] * c[3] + s[3] * c[2] -
+             s[4] * c[1] + s[5] * c[0];
+    } else {
+      Real a[kSize]{};
+      for (size_type i = 0; i < kSize; ++i) a[i] = _data[i];
+      Real det = 1;
+      for (size_type k = 0; k < Rows; ++k) {
+        size_type pivot = k;
+        for (size_type i = k + 1; i < Rows; ++i) {
+          if (s21::detail::StaticAbs(a[i * Cols + k]) >
+              s21::detail::StaticAbs(a[pivot * Cols + k])) {
+            pivot = i;
+          }
+        }
+        if (s21::detail::StaticAbs(a[pivot * Cols + k]) < kEps) return 0;
+        if (pivot != k) {
+          for (size_type j = k; j < Cols; ++j) {
+            Real tmp = a[k * Cols + j];
+            a[k * Cols + j] = a[pivot * Cols + j];
+            a[pivot * Cols + j] = tmp;
+          }
+          det = -det;
+        }
+        det *= a[k * Cols + k];
+        for (size_type i = k + 1; i < Rows; ++i) {
+          Real factor = a[i * Cols + k] / a[k * Cols + k];
+          for (size_type j = k + 1; j < Cols; ++j) {
+            a[i * Cols + j] -= factor * a[k * Cols + j];
+          }
+        }
+      }
+      return det;
+    }
+  }
+
+  // The 2x2 minors of a 4x4 matrix taken from rows 0-1 (s) and rows 2-3
+  // (c), column pairs in lexicographic order; the determinant and the
+  // adjugate are short sums of their products (Laplace expansion by
+  // complementary minors).
+  constexpr void PairMinors(Real (&s)[6], Real (&c)[6]) const noexcept {
+    const T* a = _data;
+    s[0] = Real(a[0]) * a[5] - Real(a[4]) * a[1];
+    s[1] = Real(a[0]) * a[6] - Real(a[4]) * a[2];
+    s[2] = Real(a[0]) * a[7] - Real(a[4]) * a[3];
+    s[3] = Real(a[1]) * a[6] - Real(a[5]) * a[2];
+    s[4] = Real(a[1]) * a[7] - Real(a[5]) * a[3];
+    s[5] = Real(a[2]) * a[7] - Real(a[6]) * a[3];
+    c[0] = Real(a[8]) * a[13] - Real(a[12]) * a[9];
+    c[1] = Real(a[8]) * a[14] - Real(a[12]) * a[10];
+    c[2] = Real(a[8]) * a[15] - Real(a[12]) * a[11];
+    c[3] = Real(a[9]) * a[14] - Real(a[13]) * a[10];
+    c[4] = Real(a[9]) * a[15] - Real(a[13]) * a[11];
+    c[5] = Real(a[10]) * a[15] - Real(a[14]) * a[11];
+  }
+
+  // Writes the adjugate (the transposed complements) of a matrix up to
+  // kClosedFormSize and returns the determinant.
+  constexpr Real Adjugate(Real (&adj)[kSize]) const noexcept {
+    if constexpr (Rows == 1) {
+      adj[0] = 1;
+      return _data[0];
+    } else if constexpr (Rows < 4) {
+      for (size_type r = 0; r < Rows; ++r) {
+        for (size_type c = 0; c < Cols; ++c) {
+          Real minor = MinorMatrix(c, r).Det();
+          adj[r * Cols + c] = (r + c) % 2 ? -minor : minor;
+        }
+      }
+      Real det = 0;
+      for (size_type c = 0; c < Cols; ++c) det += _data[c] * adj[c * Cols];
+      return det;
+    } else {
+      const T* a = _data;
+      Real s[6]{}, c[6]{};
+      PairMinors(s, c);
+      adj[0] = a[5] * c[5] - a[6] * c[4] + a[7] * c[3];
+      adj[1] = -a[1] * c[5] + a[2] * c[4] - a[3] * c[3];
+      adj[2] = a[13] * s[5] - a[14] * s[4] + a[15] * s[3];
+      adj[3] = -a[9] * s[5] + a[10] * s[4] - a[11] * s[3];
+      adj[4] = -a[4] * c[5] + a[6] * c[2] - a[7] * c[1];
+      adj[5] = a[0] * c[5] - a[2] * c[2] + a[3] * c[1];
+      adj[6] = -a[12] * s[5] + a[14] * s[2] - a[15] * s[1];
+      adj[7] = a[8] * s[5] - a[10] * s[2] + a[11] * s[1];
+      adj[8] = a[4] * c[4] - a[5] * c[2] + a[7] * c[0];
+      adj[9] = -a[0] * c[4] + a[1] * c[2] - a[3] * c[0];
+      adj[10] = a[12] * s[4] - a[13] * s[2] + a[15] * s[0];
+      adj[11] = -a[8] * s[4] + a[9] * s[2] - a[11] * s[0];
+      adj[12] = -a[4] * c[3] + a[5] * c[1] - a[6] * c[0];
+      adj[13] = a[0] * c[3] - a[1] * c[1] + a[2] * c[0];
+      adj[14] = -a[12] * s[3] + a[13] * s[1] - a[14] * s[0];
+      adj[15] = a[8] * s[3] - a[9] * s[1] + a[10] * s[0];
+      return s[0] * c[5] - s[1] * c[4] + s[2] * c[3] + s[3] * c[2] -
+             s[4] * c[1] + s[5] * c[0];
+    }
+  }
+
+  static constexpr void CheckIsNonsingular(Real det) {
+    if (s21::detail::StaticAbs(det) < kEps) {
+      throw std::logic_error("The determinant is zero.");
+    }
+  }
+
+  static constexpr void CheckIndexUpperBound(size_type idx, size_type upper) {
+    if (idx >= upper) {
+      throw std::out_of_range(std::string("index ") + std::to_string(idx) +
+                              " >= " + std::to_string(upper));
+    }
+  }
+
+  T _data[kSize]{};
+};
+
+#endif  // S21_MATRIXPLUSPLUS_SRC_S21_MATRIX_STATIC_H_
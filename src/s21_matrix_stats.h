@@ -0,0 +1,250 @@
+#ifndef S21_MATRIXPLUSPLUS_SRC_S21_MATRIX_STATS_H_
+#define S21_MATRIXPLUSPLUS_SRC_S21_MATRIX_STATS_H_
+
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <iostream>
+
+// Per-operation instrumentation of S21Matrix: call counts, elements
+// processed, wall time (total and a histogram), heap bytes allocated and
+// copies versus moves of matrices. It is compiled in only when
+// S21_MATRIX_STATS is defined, which must then hold for every translation
+// unit of the program. Without it the hooks in S21Matrix expand to
+// nothing and GetStats() returns zeros.
+//
+// Times are inclusive: InverseMatrix() also counts the Determinant() and
+// Transpose() calls it makes. Allocations, copies and moves go to the
+// innermost operation running on the thread, or to kOther outside any.
+namespace s21 {
+
+enum class Operation : std::size_t {
+  kSum,
+  kSub,
+  kMulNumber,
+  kMulMatrix,
+  kTranspose,
+  kCalcComplements,
+  kDeterminant,
+  kInverse,
+  kEvaluate,  // an expression such as `a + b * 2.0` written into a matrix
+  kOther,
+  kCount
+};
+
+inline constexpr std::size_t kOperationCount =
+    static_cast<std::size_t>(Operation::kCount);
+
+// bucket i counts calls that took [2^i, 2^(i+1)) ns, the first one also
+// shorter ones and the last one also longer ones
+inline constexpr std::size_t kTimeBuckets = 40;
+
+#ifdef S21_MATRIX_STATS
+inline constexpr bool kStatsEnabled = true;
+#else
+inline constexpr bool kStatsEnabled = false;
+#endif
+
+inline const char* OperationName(Operation op) noexcept {
+  static constexpr const char* kNames[kOperationCount] = {
+      "SumMatrix",   "SubMatrix",     "MulNumber",
+      "MulMatrix",   "Transpose",     "CalcComplements",
+      "Determinant", "InverseMatrix", "Evaluate",
+      "Other"};
+  std::size_t idx = static_cast<std::size_t>(op);
+  return idx < kOperationCount ? kNames[idx] : "Unknown";
+}
+
+struct OperationStats {
+  std::uint64_t calls = 0;
+  // elements of the matrix produced (of the operand for Determinant)
+  std::uint64_t elements = 0;
+  std::uint64_t nanoseconds = 0;
+  std::array<std::uint64_t, kTimeBuckets> histogram{};
+  std::uint64_t allocations = 0;
+  std::uint64_t bytes_allocated = 0;
+  std::uint64_t copies = 0;
+  std::uint64_t moves = 0;
+};
+
+struct StatsSnapshot {
+  std::array<OperationStats, kOperationCount> operations{};
+
+  const OperationStats& operator[](Operation op) const noexcept {
+    return operations[static_cast<std::size_t>(op)];
+  }
+};
+
+namespace detail {
+
+struct AtomicOperationStats {
+  std::atomic<std::uint64_t> calls{0};
+  std::atomic<std::uint64_t> elements{0};
+  std::atomic<std::uint64_t> nanoseconds{0};
+  std::array<std::atomic<std::uint64_t>, kTimeBuckets> histogram{};
+  std::atomic<std::uint64_t> allocations{0};
+  std::atomic<std::uint64_t> bytes_allocated{0};
+  std::atomic<std::uint64_t> copies{0};
+  std::atomic<std::uint64_t> moves{0};
+};
+
+inline std::array<AtomicOperationStats, kOperationCount>& GlobalStats() {
+  static std::array<AtomicOperationStats, kOperationCount> stats;
+  return stats;
+}
+
+inline thread_local Operation tls_operation = Operation::kOther;
+
+inline AtomicOperationStats& CurrentStats() {
+  return GlobalStats()[static_cast<std::size_t>(tls_operation)];
+}
+
+inline void Add(std::atomic<std::uint64_t>& counter,
+                std::uint64_t value) noexcept {
+  counter.fetch_add(value, std::memory_order_relaxed);
+}
+
+inline std::size_t TimeBucket(std::uint64_t ns) noexcept {
+  std::size_t bucket = 0;
+  while (ns > 1 && bucket + 1 < kTimeBuckets) {
+    ns >>= 1;
+    ++bucket;
+  }
+  return bucket;
+}
+
+// Counts and times one call of `op` for as long as it is alive.
+class ScopedOperation {
+ public:
+  ScopedOperation(Operation op, std::size_t elements) noexcept
+      : _op(op),
+        _saved(tls_operation),
+        _start(std::chrono::steady_clock::now()) {
+    tls_operation = op;
+    AtomicOperationStats& stats = GlobalStats()[static_cast<std::size_t>(op)];
+    Add(stats.calls, 1);
+    Add(stats.elements, elements);
+  }
+
+  ScopedOperation(const ScopedOperation&) = delete;
+  ScopedOperation& operator=(const ScopedOperation&) = delete;
+
+  ~ScopedOperation() noexcept {
+    auto elapsed = std::chrono::steady_clock::now() - _start;
+    std::uint64_t ns = static_cast<std::uint64_t>(
+        std::chrono::duration_cast<std::chrono::nanoseconds>(elapsed).count());
+    AtomicOperationStats& stats = GlobalStats()[static_cast<std::size_t>(_op)];
+    Add(stats.nanoseconds, ns);
+    Add(stats.histogram[TimeBucket(ns)], 1);
+    tls_operation = _saved;
+  }
+
+ private:
+  Operation _op;
+  Operation _saved;
+  std::chrono::steady_clock::time_point _start;
+};
+
+inline void CountAllocation(std::size_t bytes) noexcept {
+  AtomicOperationStats& stats = CurrentStats();
+  Add(stats.allocations, 1);
+  Add(stats.bytes_allocated, bytes);
+}
+
+inline void CountCopy() noexcept { Add(CurrentStats().copies, 1); }
+
+inline void CountMove() noexcept { Add(CurrentStats().moves, 1); }
+
+}  // namespace detail
+
+// The counters so far. Counters of operations still running on other
+// threads may be caught half-updated.
+inline StatsSnapshot GetStats() {
+  StatsSnapshot snapshot;
+  if constexpr (kStatsEnabled) {
+    auto load = [](const std::atomic<std::uint64_t>& counter) {
+      return counter.load(std::memory_order_relaxed);
+    };
+    for (std::size_t i = 0; i < kOperationCount; ++i) {
+      const detail::AtomicOperationStats& src = detail::GlobalStats()[i];
+      OperationStats& dst = snapshot.operations[i];
+      dst.calls = load(src.calls);
+      dst.elements = load(src.elements);
+      dst.nanoseconds = load(src.nanoseconds);
+      for (std::size_t b = 0; b < kTimeBuckets; ++b) {
+        dst.histogram[b] = load(src.histogram[b]);
+      }
+      dst.allocations = load(src.allocations);
+      dst.bytes_allocated = load(src.bytes_allocated);
+      dst.copies = load(src.copies);
+      dst.moves = load(src.moves);
+    }
+  }
+  return snapshot;
+}
+
+inline void ResetStats() noexcept {
+  if constexpr (kStatsEnabled) {
+    auto clear = [](std::atomic<std::uint64_t>& counter) {
+      counter.store(0, std::memory_order_relaxed);
+    };
+    for (detail::AtomicOperationStats& stats : detail::GlobalStats()) {
+      clear(stats.calls);
+      clear(stats.elements);
+      clear(stats.nanoseconds);
+      for (auto& bucket : stats.histogram) clear(bucket);
+      clear(stats.allocations);
+      clear(stats.bytes_allocated);
+      clear(stats.copies);
+      clear(stats.moves);
+    }
+  }
+}
+
+// Writes the operations that were called or allocated as one JSON
+// object keyed by operation name. The histogram lists the nonzero
+// buckets as {"<lower bound in ns>": calls}.
+inline void WriteStatsJson(std::ostream& os, const StatsSnapshot& snapshot) {
+  os << '{';
+  bool first = true;
+  for (std::size_t i = 0; i < kOperationCount; ++i) {
+    const OperationStats& stats = snapshot.operations[i];
+    if (!stats.calls && !stats.allocations && !stats.copies && !stats.moves) {
+      continue;
+    }
+    os << (first ? "" : ",") << "\n  \""
+       << OperationName(static_cast<Operation>(i)) << "\": {"
+       << "\"calls\": " << stats.calls << ", \"elements\": " << stats.elements
+       << ", \"nanoseconds\": " << stats.nanoseconds
+       << ", \"allocations\": " << stats.allocations
+       << ", \"bytes_allocated\": " << stats.bytes_allocated
+       << ", \"copies\": " << stats.copies << ", \"moves\": " << stats.moves
+       << ", \"histogram\": {";
+    bool first_bucket = true;
+    for (std::size_t b = 0; b < kTimeBuckets; ++b) {
+      if (!stats.histogram[b]) continue;
+      os << (first_bucket ? "" : ", ") << '"' << (b ? std::uint64_t{1} << b : 0)
+         << "\": " << stats.histogram[b];
+      first_bucket = false;
+    }
+    os << "}}";
+    first = false;
+  }
+  os << (first ? "}" : "\n}") << '\n';
+}
+
+}  // namespace s21
+
+// Hooks used inside S21Matrix; empty unless S21_MATRIX_STATS is defined.
+#ifdef S21_MATRIX_STATS
+#define S21_MATRIX_STATS_SCOPE(op, elements) \
+  s21::detail::ScopedOperation s21_stats_scope_((op), (elements))
+#define S21_MATRIX_STATS_COUNT(hook) s21::detail::hook
+#else
+#define S21_MATRIX_STATS_SCOPE(op, elements) static_cast<void>(0)
+#define S21_MATRIX_STATS_COUNT(hook) static_cast<void>(0)
+#endif
+
+#endif  // S21_MATRIXPLUSPLUS_SRC_S21_MATRIX_STATS_H_
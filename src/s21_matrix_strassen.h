@@ -0,0 +1,269 @@
+#ifndef S21_MATRIXPLUSPLUS_SRC_S21_MATRIX_STRASSEN_H_
+#define S21_MATRIXPLUSPLUS_SRC_S21_MATRIX_STRASSEN_H_
+
+#include <algorithm>
+#include <cstddef>
+#include <memory_resource>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include "s21_matrix_gemm.h"
+#include "s21_matrix_oop.h"
+#include "s21_matrix_thread_pool.h"
+
+namespace s21 {
+
+// Below this size in any dimension a block is multiplied by the regular
+// kernel; about there the packed GEMM and one more level of the recursion
+// break even on AVX-512 hardware.
+inline constexpr std::size_t kStrassenCutoff = 256;
+
+namespace detail {
+
+inline bool IsStrassenLeaf(std::size_t m, std::size_t k, std::size_t n,
+                           std::size_t cutoff) noexcept {
+  return std::min({m, k, n}) <= std::max<std::size_t>(cutoff, 1);
+}
+
+// Elements of scratch space the recursion on an m x k by k x n product
+// needs: at each level one operand of each kind and one product of
+// half the size, reused by the seven sub-products in turn.
+inline std::size_t StrassenWorkspace(std::size_t m, std::size_t k,
+                                     std::size_t n, std::size_t cutoff) {
+  if (IsStrassenLeaf(m, k, n, cutoff)) return 0;
+  std::size_t mh = m / 2, kh = k / 2, nh = n / 2;
+  return mh * kh + kh * nh + mh * nh + StrassenWorkspace(mh, kh, nh, cutoff);
+}
+
+// dst = x + sign * y over a rows x cols block
+template <typename T>
+void BlockCombine(std::size_t rows, std::size_t cols, const T* x,
+                  std::size_t ldx, const T* y, std::size_t ldy, T sign,
+                  T* dst, std::size_t ldd) noexcept {
+  for (std::size_t r = 0; r < rows; ++r) {
+    const T* xr = x + r * ldx;
+    const T* yr = y + r * ldy;
+    T* dr = dst + r * ldd;
+    for (std::size_t c = 0; c < cols; ++c) dr[c] = xr[c] + sign * yr[c];
+  }
+}
+
+// dst += sign * src, or dst = src when `assign`
+template <typename T>
+void BlockUpdate(std::size_t rows, std::size_t cols, const T* src,
+                 std::size_t lds, T sign, bool assign, T* dst,
+                 std::size_t ldd) noexcept {
+  for (std::size_t r = 0; r < rows; ++r) {
+    const T* sr = src + r * lds;
+    T* dr = dst + r * ldd;
+    if (assign) {
+      std::copy_n(sr, cols, dr);
+    } else {
+      for (std::size_t c = 0; c < cols; ++c) dr[c] += sign * sr[c];
+    }
+  }
+}
+
+// The quadrants of the even-sized leading parts of A (m2 x k2),
+// B (k2 x n2) and C (m2 x n2).
+template <typename T>
+struct StrassenQuadrants {
+  std::size_t mh, kh, nh;
+  const T* a[2][2];
+  std::size_t lda;
+  const T* b[2][2];
+  std::size_t ldb;
+  T* c[2][2];
+  std::size_t ldc;
+
+  StrassenQuadrants(std::size_t m, std::size_t k, std::size_t n, const T* pa,
+                    std::size_t la, const T* pb, std::size_t lb, T* pc,
+                    std::size_t lc) noexcept
+      : mh(m / 2), kh(k / 2), nh(n / 2), lda(la), ldb(lb), ldc(lc) {
+    for (std::size_t i = 0; i < 2; ++i) {
+      for (std::size_t j = 0; j < 2; ++j) {
+        a[i][j] = pa + i * mh * lda + j * kh;
+        b[i][j] = pb + i * kh * ldb + j * nh;
+        c[i][j] = pc + i * mh * ldc + j * nh;
+      }
+    }
+  }
+};
+
+// Operands of Strassen's sub-product i, formed in s (mh x kh) and
+// t (kh x nh) where they are sums; quadrants are used in place:
+//   M0 = (A11 + A22)(B11 + B22)   M4 = (A11 + A12) B22
+//   M1 = (A21 + A22) B11          M5 = (A21 - A11)(B11 + B12)
+//   M2 = A11 (B12 - B22)          M6 = (A12 - A22)(B21 + B22)
+//   M3 = A22 (B21 - B11)
+template <typename T>
+void StrassenOperands(const StrassenQuadrants<T>& q, int i, T* s, T* t,
+                      const T*& lhs, std::size_t& ldl, const T*& rhs,
+                      std::size_t& ldr) noexcept {
+  // index pairs of the A and B terms and the sign of the second term;
+  // a second index of -1 means the quadrant is used alone
+  static constexpr int kA[7][5] = {{0, 0, 1, 1, 1},  {1, 0, 1, 1, 1},
+                                   {0, 0, -1, 0, 0}, {1, 1, -1, 0, 0},
+                                   {0, 0, 0, 1, 1},  {1, 0, 0, 0, -1},
+                                   {0, 1, 1, 1, -1}};
+  static constexpr int kB[7][5] = {{0, 0, 1, 1, 1},  {0, 0, -1, 0, 0},
+                                   {0, 1, 1, 1, -1}, {1, 0, 0, 0, -1},
+                                   {1, 1, -1, 0, 0}, {0, 0, 0, 1, 1},
+                                   {1, 0, 1, 1, 1}};
+  const int* ea = kA[i];
+  if (ea[2] < 0) {
+    lhs = q.a[ea[0]][ea[1]];
+    ldl = q.lda;
+  } else {
+    BlockCombine(q.mh, q.kh, q.a[ea[0]][ea[1]], q.lda, q.a[ea[2]][ea[3]],
+                 q.lda, static_cast<T>(ea[4]), s, q.kh);
+    lhs = s;
+    ldl = q.kh;
+  }
+  const int* eb = kB[i];
+  if (eb[2] < 0) {
+    rhs = q.b[eb[0]][eb[1]];
+    ldr = q.ldb;
+  } else {
+    BlockCombine(q.kh, q.nh, q.b[eb[0]][eb[1]], q.ldb, q.b[eb[2]][eb[3]],
+                 q.ldb, static_cast<T>(eb[4]), t, q.nh);
+    rhs = t;
+    ldr = q.nh;
+  }
+}
+
+// Adds sub-product i (mh x nh, dense) into the quadrants of C; applied
+// for i = 0..6 in order they assemble
+//   C11 = M0 + M3 - M4 + M6   C12 = M2 + M4
+//   C21 = M1 + M3             C22 = M0 - M1 + M2 + M5
+template <typename T>
+void StrassenAccumulate(const StrassenQuadrants<T>& q, int i,
+                        const T* p) noexcept {
+  // (row, col, sign, assign) of up to two C quadrants per sub-product
+  static constexpr int kC[7][2][4] = {
+      {{0, 0, 1, 1}, {1, 1, 1, 1}},  {{1, 0, 1, 1}, {1, 1, -1, 0}},
+      {{0, 1, 1, 1}, {1, 1, 1, 0}},  {{0, 0, 1, 0}, {1, 0, 1, 0}},
+      {{0, 0, -1, 0}, {0, 1, 1, 0}}, {{1, 1, 1, 0}, {0, 0, 0, 0}},
+      {{0, 0, 1, 0}, {0, 0, 0, 0}}};
+  for (const auto& u : kC[i]) {
+    if (!u[2]) continue;
+    BlockUpdate(q.mh, q.nh, p, q.nh, static_cast<T>(u[2]), u[3] != 0,
+                q.c[u[0]][u[1]], q.ldc);
+  }
+}
+
+template <typename T>
+void Strassen(std::size_t m, std::size_t k, std::size_t n, const T* a,
+              std::size_t lda, const T* b, std::size_t ldb, T* c,
+              std::size_t ldc, std::size_t cutoff, T* work, bool parallel);
+
+// The odd last row, column or inner index left over by halving: the
+// regular kernel adds their contribution around the even leading part.
+template <typename T>
+void StrassenFringe(std::size_t m, std::size_t k, std::size_t n, const T* a,
+                    std::size_t lda, const T* b, std::size_t ldb, T* c,
+                    std::size_t ldc) {
+  std::size_t m2 = m & ~std::size_t{1}, k2 = k & ~std::size_t{1},
+              n2 = n & ~std::size_t{1};
+  if (k2 != k) {
+    Gemm(m2, n2, std::size_t{1}, a + k2, lda, b + k2 * ldb, ldb, c, ldc);
+  }
+  if (n2 != n) {
+    for (std::size_t r = 0; r < m2; ++r) c[r * ldc + n2] = T{};
+    Gemm(m2, std::size_t{1}, k, a, lda, b + n2, ldb, c + n2, ldc);
+  }
+  if (m2 != m) {
+    std::fill_n(c + m2 * ldc, n, T{});
+    Gemm(std::size_t{1}, n, k, a + m2 * lda, lda, b, ldb, c + m2 * ldc, ldc);
+  }
+}
+
+// C = A * B by Strassen's recursion down to `cutoff`, with the scratch
+// space of StrassenWorkspace (times seven when `parallel`) at `work`.
+// In parallel the seven sub-products of the top level run as separate
+// tasks, each into its own part of the workspace, and are added up in
+// the same order as serially, so the result does not depend on threads.
+template <typename T>
+void Strassen(std::size_t m, std::size_t k, std::size_t n, const T* a,
+              std::size_t lda, const T* b, std::size_t ldb, T* c,
+              std::size_t ldc, std::size_t cutoff, T* work, bool parallel) {
+  if (IsStrassenLeaf(m, k, n, cutoff)) {
+    for (std::size_t r = 0; r < m; ++r) std::fill_n(c + r * ldc, n, T{});
+    Gemm(m, n, k, a, lda, b, ldb, c, ldc);
+    return;
+  }
+  StrassenQuadrants<T> q(m, k, n, a, lda, b, ldb, c, ldc);
+  std::size_t mh = q.mh, kh = q.kh, nh = q.nh;
+  std::size_t part = StrassenWorkspace(m, k, n, cutoff);
+  // s, t and p of one sub-product followed by the scratch of its recursion
+  auto product = [&](int i, T* w) {
+    T* s = w;
+    T* t = s + mh * kh;
+    T* p = t + kh * nh;
+    const T* lhs;
+    const T* rhs;
+    std::size_t ldl, ldr;
+    StrassenOperands(q, i, s, t, lhs, ldl, rhs, ldr);
+    Strassen(mh, kh, nh, lhs, ldl, rhs, ldr, p, nh, cutoff, p + mh * nh,
+             false);
+    return p;
+  };
+  if (parallel) {
+    s21::ParallelFor(7, mh * kh * nh, [&](std::size_t begin, std::size_t end) {
+      // the sub-products themselves stay on this thread
+      s21::ScopedExecutionPolicy serial({1});
+      for (std::size_t i = begin; i < end; ++i) {
+        product(static_cast<int>(i), work + i * part);
+      }
+    });
+    for (int i = 0; i < 7; ++i) {
+      StrassenAccumulate(q, i, work + i * part + mh * kh + kh * nh);
+    }
+  } else {
+    for (int i = 0; i < 7; ++i) StrassenAccumulate(q, i, product(i, work));
+  }
+  StrassenFringe(m, k, n, a, lda, b, ldb, c, ldc);
+}
+
+}  // namespace detail
+
+// lhs * rhs by Strassen's algorithm: O(n^2.81) multiplications instead
+// of O(n^3), for large matrices. Blocks of `cutoff` or fewer rows, inner
+// indices or columns go to the regular kernel, and odd sizes are peeled
+// off to it as well. The scratch space, about one matrix of the size of
+// the result, is allocated once per call from the resource of lhs; with
+// more than one thread in the execution policy the seven top-level
+// sub-products run in parallel and need seven times as much.
+// The error bound grows faster with the size than that of MulMatrix,
+// roughly by a factor of 3 to 4 per level of recursion.
+template <typename T>
+S21Matrix<T> StrassenMulMatrix(const S21MatrixView<const T>& lhs,
+                               const S21MatrixView<const T>& rhs,
+                               std::size_t cutoff = kStrassenCutoff) {
+  if (lhs.GetCols() != rhs.GetRows()) {
+    std::string errmsg = std::string("this cols (") +
+                         std::to_string(lhs.GetCols()) +
+                         std::string(" != other rows (") +
+                         std::to_string(rhs.GetRows()) + std::string(")");
+    throw std::logic_error(errmsg);
+  }
+  std::size_t m = lhs.GetRows(), k = lhs.GetCols(), n = rhs.GetCols();
+  S21Matrix<T> res(m, n, lhs.GetResource());
+  if (detail::IsStrassenLeaf(m, k, n, cutoff)) {
+    detail::Gemm(m, n, k, lhs.Data(), lhs.GetStride(), rhs.Data(),
+                 rhs.GetStride(), res.Data(), res.GetStride());
+    return res;
+  }
+  bool parallel = detail::ResolveThreads(GetExecutionPolicy().threads) > 1;
+  std::size_t size = detail::StrassenWorkspace(m, k, n, cutoff);
+  std::pmr::vector<T> work(parallel ? 7 * size : size, lhs.GetResource());
+  detail::Strassen(m, k, n, lhs.Data(), lhs.GetStride(), rhs.Data(),
+                   rhs.GetStride(), res.Data(), res.GetStride(), cutoff,
+                   work.data(), parallel);
+  return res;
+}
+
+}  // namespace s21
+
+#endif  // S21_MATRIXPLUSPLUS_SRC_S21_MATRIX_STRASSEN_H_
@@ -0,0 +1,474 @@
+#ifndef S21_MATRIXPLUSPLUS_SRC_S21_MATRIX_TEXT_H_
+#define S21_MATRIXPLUSPLUS_SRC_S21_MATRIX_TEXT_H_
+
+#include <algorithm>
+#include <cctype>
+#include <charconv>
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <iostream>
+#include <new>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <system_error>
+#include <type_traits>
+
+#include "s21_matrix_oop.h"
+
+// Text I/O for S21Matrix in CSV and Matrix Market (array and coordinate)
+// formats. Numbers are formatted and parsed with std::to_chars and
+// std::from_chars: floating values are written in the shortest form that
+// reads back to the same bits, so a save/load round trip is exact.
+// Writers format straight into a fixed buffer that is flushed to the
+// stream in large blocks, with no allocation per element. Readers stream
+// the input a block at a time and parse the numbers of each line directly
+// into the matrix storage.
+namespace s21 {
+
+namespace detail {
+
+// Buffered number formatting on top of a std::ostream.
+class TextWriter {
+ public:
+  explicit TextWriter(std::ostream& os) noexcept : _os(os) {}
+
+  TextWriter(const TextWriter&) = delete;
+  TextWriter& operator=(const TextWriter&) = delete;
+
+  ~TextWriter() { Flush(); }
+
+  void Put(char ch) {
+    if (_size == kCapacity) Flush();
+    _buffer[_size++] = ch;
+  }
+
+  void Put(std::string_view text) {
+    for (char ch : text) Put(ch);
+  }
+
+  template <typename T>
+  void PutNumber(T value) {
+    if (kCapacity - _size < kMaxNumberChars) Flush();
+    char* begin = _buffer + _size;
+    std::to_chars_result res;
+    if constexpr (std::is_same_v<T, bool>) {
+      res = std::to_chars(begin, _buffer + kCapacity, static_cast<int>(value));
+    } else {
+      res = std::to_chars(begin, _buffer + kCapacity, value);
+    }
+    _size = res.ptr - _buffer;
+  }
+
+  void Flush() {
+    _os.write(_buffer, _size);
+    _size = 0;
+  }
+
+ private:
+  static constexpr std::size_t kCapacity = 64 * 1024;
+  // enough for the shortest round-trip form of any arithmetic type
+  static constexpr std::size_t kMaxNumberChars = 64;
+
+  std::ostream& _os;
+  std::size_t _size{0};
+  char _buffer[kCapacity];
+};
+
+[[noreturn]] inline void FailAtLine(std::size_t line,
+                                     const std::string& message) {
+  throw std::runtime_error("line " + std::to_string(line) + ": " + message);
+}
+
+// The lines of an input stream, read in blocks of kChunk bytes. A line
+// cut by the end of a block is carried over to the front of the buffer
+// before the next block is read, so only one block, or the longest line,
+// is held in memory whatever the size of the input.
+class LineReader {
+ public:
+  explicit LineReader(std::istream& is) noexcept : _is(is) {}
+
+  LineReader(const LineReader&) = delete;
+  LineReader& operator=(const LineReader&) = delete;
+
+  // The next line without its '\n', valid until the following call.
+  // Returns false at the end of the input.
+  bool Next(std::string_view& line) {
+    while (true) {
+      const char* begin = _buffer.data() + _pos;
+      const char* eol = static_cast<const char*>(
+          std::memchr(begin, '\n', _size - _pos));
+      if (eol || (_eof && _pos < _size)) {
+        std::size_t length = eol ? eol - begin : _size - _pos;
+        line = std::string_view(begin, length);
+        _pos += eol ? length + 1 : length;
+        ++_line;
+        return true;
+      }
+      if (_eof) return false;
+      Refill();
+    }
+  }
+
+  // the number of the last line returned, from 1
+  std::size_t GetLine() const noexcept { return _line; }
+
+ private:
+  static constexpr std::size_t kChunk = 64 * 1024;
+
+  void Refill() {
+    std::size_t tail = _size - _pos;
+    std::memmove(_buffer.data(), _buffer.data() + _pos, tail);
+    _pos = 0;
+    _size = tail;
+    if (_buffer.size() < _size + kChunk) _buffer.resize(_size + kChunk);
+    _is.read(_buffer.data() + _size, kChunk);
+    _size += _is.gcount();
+    if (!_is) {
+      if (_is.bad()) throw std::runtime_error("failed to read the matrix");
+      _eof = true;
+    }
+  }
+
+  std::istream& _is;
+  std::string _buffer;
+  std::size_t _pos{0}, _size{0};
+  std::size_t _line{0};
+  bool _eof{false};
+};
+
+inline bool IsBlank(char ch) noexcept {
+  return ch == ' ' || ch == '\t' || ch == '\r';
+}
+
+// One line being parsed, with its number for messages. Blanks are skipped
+// around numbers. A field delimiter that is itself a blank, a space or a
+// tab, separates fields as a run of any blanks.
+class TextCursor {
+ public:
+  TextCursor(std::string_view text, std::size_t line,
+             char delimiter = '\n') noexcept
+      : _text(text),
+        _line(line),
+        _delimiter(delimiter),
+        _blank_delimiter(IsBlank(delimiter)) {}
+
+  bool AtEnd() const noexcept { return _pos == _text.size(); }
+
+  char Peek() const noexcept { return AtEnd() ? '\n' : _text[_pos]; }
+
+  void SkipBlanks() noexcept {
+    while (!AtEnd() && IsBlank(_text[_pos]) &&
+           (_blank_delimiter || _text[_pos] != _delimiter)) {
+      ++_pos;
+    }
+  }
+
+  // skips what separates two fields, false if there is no delimiter
+  bool SkipDelimiter() noexcept {
+    std::size_t start = _pos;
+    SkipBlanks();
+    return _blank_delimiter ? _pos != start : Accept(_delimiter);
+  }
+
+  // consumes `ch` if it is next
+  bool Accept(char ch) noexcept {
+    if (AtEnd() || _text[_pos] != ch) return false;
+    ++_pos;
+    return true;
+  }
+
+  template <typename T>
+  T ParseNumber() {
+    SkipBlanks();
+    const char* begin = _text.data() + _pos;
+    const char* end = _text.data() + _text.size();
+    if (begin != end && *begin == '+') ++begin;
+    T value{};
+    std::from_chars_result res;
+    if constexpr (std::is_same_v<T, bool>) {
+      int number = 0;
+      res = std::from_chars(begin, end, number);
+      if (res.ec == std::errc() && number != 0 && number != 1) {
+        res.ec = std::errc::result_out_of_range;
+      }
+      value = number;
+    } else {
+      res = std::from_chars(begin, end, value);
+    }
+    if (res.ec != std::errc()) {
+      std::string_view token = _text.substr(_pos);
+      token = token.substr(0, token.find_first_of(",; \t\r"));
+      Fail(std::string(res.ec == std::errc::result_out_of_range
+                           ? "number out of range '"
+                           : "invalid number '") +
+           std::string(token) + "'");
+    }
+    _pos = res.ptr - _text.data();
+    return value;
+  }
+
+  std::size_t ParseIndex() { return ParseNumber<std::size_t>(); }
+
+  // the rest of the line must be blank
+  void EndLine() {
+    SkipBlanks();
+    if (!AtEnd()) Fail("unexpected '" + std::string(1, Peek()) + "'");
+  }
+
+  [[noreturn]] void Fail(const std::string& message) const {
+    FailAtLine(_line, message);
+  }
+
+ private:
+  std::string_view _text;
+  std::size_t _pos{0};
+  std::size_t _line;
+  char _delimiter;
+  bool _blank_delimiter;
+};
+
+inline bool IsBlankLine(std::string_view line) noexcept {
+  return line.find_first_not_of(" \t\r") == std::string_view::npos;
+}
+
+// the fields of a CSV line: runs of blanks with a blank delimiter, so
+// that leading and trailing blanks do not count
+inline std::size_t CountFields(std::string_view line, char delimiter) {
+  if (!IsBlank(delimiter)) {
+    return std::count(line.begin(), line.end(), delimiter) + 1;
+  }
+  std::size_t fields = 0;
+  for (std::size_t i = 0; i < line.size(); ++i) {
+    fields += !IsBlank(line[i]) && (!i || IsBlank(line[i - 1]));
+  }
+  return fields;
+}
+
+inline std::string Lowercase(std::string_view text) {
+  std::string lower(text);
+  std::transform(lower.begin(), lower.end(), lower.begin(),
+                 [](unsigned char ch) { return std::tolower(ch); });
+  return lower;
+}
+
+}  // namespace detail
+
+// CSV
+
+// One line per row, fields separated by `delimiter`.
+template <typename T>
+void WriteCsv(std::ostream& os, S21MatrixView<T> mtx, char delimiter = ',') {
+  detail::TextWriter writer(os);
+  for (std::size_t r = 0; r < mtx.GetRows(); ++r) {
+    const T* row = mtx.RowData(r);
+    for (std::size_t c = 0; c < mtx.GetCols(); ++c) {
+      if (c) writer.Put(delimiter);
+      writer.PutNumber(row[c]);
+    }
+    writer.Put('\n');
+  }
+  writer.Flush();
+  if (!os) throw std::runtime_error("failed to write the matrix");
+}
+
+template <typename T>
+void WriteCsv(std::ostream& os, const S21Matrix<T>& mtx,
+              char delimiter = ',') {
+  WriteCsv(os, mtx.View(), delimiter);
+}
+
+// Every non-blank line is a row and all rows must have the same number of
+// fields. Blanks around fields and CRLF line ends are accepted; with a
+// space or tab delimiter, fields are separated by any run of blanks. The
+// input is read a block at a time and rows are appended to the matrix as
+// they are parsed.
+template <typename T>
+S21Matrix<T> ReadCsv(std::istream& is, char delimiter = ',',
+                     const typename S21Matrix<T>::allocator_type& alloc = {}) {
+  detail::LineReader reader(is);
+  S21Matrix<T> mtx(alloc);
+  std::size_t cols = 0;
+  std::string_view line;
+  while (reader.Next(line)) {
+    if (detail::IsBlankLine(line)) continue;
+    if (!cols) {
+      cols = detail::CountFields(line, delimiter);
+      mtx = S21Matrix<T>(0, cols, alloc);
+    }
+    detail::TextCursor cursor(line, reader.GetLine(), delimiter);
+    T* row = mtx.AppendRow();
+    for (std::size_t c = 0; c < cols; ++c) {
+      if (c && !cursor.SkipDelimiter()) {
+        cursor.Fail("expected " + std::to_string(cols) + " fields, found " +
+                    std::to_string(c));
+      }
+      row[c] = cursor.ParseNumber<T>();
+    }
+    // a delimiter after the last field, other than trailing blanks
+    if (cursor.SkipDelimiter() &&
+        !(cursor.AtEnd() && detail::IsBlank(delimiter))) {
+      cursor.Fail("more than " + std::to_string(cols) + " fields");
+    }
+    cursor.EndLine();
+  }
+  return mtx;
+}
+
+// Matrix Market
+
+// The dense `array` format, which lists the elements column by column.
+template <typename T>
+void WriteMatrixMarket(std::ostream& os, S21MatrixView<T> mtx) {
+  using value_type = typename S21MatrixView<T>::value_type;
+  detail::TextWriter writer(os);
+  writer.Put("%%MatrixMarket matrix array ");
+  writer.Put(std::is_floating_point_v<value_type> ? "real" : "integer");
+  writer.Put(" general\n");
+  writer.PutNumber(mtx.GetRows());
+  writer.Put(' ');
+  writer.PutNumber(mtx.GetCols());
+  writer.Put('\n');
+  for (std::size_t c = 0; c < mtx.GetCols(); ++c) {
+    for (std::size_t r = 0; r < mtx.GetRows(); ++r) {
+      writer.PutNumber(mtx.RowData(r)[c]);
+      writer.Put('\n');
+    }
+  }
+  writer.Flush();
+  if (!os) throw std::runtime_error("failed to write the matrix");
+}
+
+template <typename T>
+void WriteMatrixMarket(std::ostream& os, const S21Matrix<T>& mtx) {
+  WriteMatrixMarket(os, mtx.View());
+}
+
+// Reads the `array` and `coordinate` formats with `real`, `integer` or
+// (coordinate only) `pattern` values, and `general`, `symmetric` or
+// `skew-symmetric` structure. Missing coordinate entries are zero.
+template <typename T>
+S21Matrix<T> ReadMatrixMarket(
+    std::istream& is,
+    const typename S21Matrix<T>::allocator_type& alloc = {}) {
+  detail::LineReader reader(is);
+  std::string_view line;
+  if (!reader.Next(line)) line = {};
+  std::string banner = detail::Lowercase(line);
+  char object[16] = {}, format[16] = {}, field[16] = {}, symmetry[16] = {};
+  auto fail = [&reader](const std::string& message) {
+    detail::FailAtLine(std::max<std::size_t>(1, reader.GetLine()), message);
+  };
+  if (std::sscanf(banner.c_str(), "%%%%matrixmarket %15s %15s %15s %15s",
+                  object, format, field, symmetry) != 4 ||
+      std::strcmp(object, "matrix")) {
+    fail("not a Matrix Market matrix header");
+  }
+  bool coordinate = !std::strcmp(format, "coordinate");
+  bool pattern = !std::strcmp(field, "pattern");
+  bool symmetric = !std::strcmp(symmetry, "symmetric");
+  bool skew = !std::strcmp(symmetry, "skew-symmetric");
+  if (!coordinate && std::strcmp(format, "array")) {
+    fail(std::string("unsupported format ") + format);
+  }
+  if (std::strcmp(field, "real") && std::strcmp(field, "integer") &&
+      std::strcmp(field, "double") && !(pattern && coordinate)) {
+    fail(std::string("unsupported field ") + field);
+  }
+  if (!symmetric && !skew && std::strcmp(symmetry, "general")) {
+    fail(std::string("unsupported symmetry ") + symmetry);
+  }
+  // the next line with data, past comments and blank lines
+  auto next_line = [&](bool comments) {
+    while (reader.Next(line)) {
+      if (!detail::IsBlankLine(line) && !(comments && line[0] == '%')) {
+        return detail::TextCursor(line, reader.GetLine());
+      }
+    }
+    detail::FailAtLine(reader.GetLine() + 1, "unexpected end of data");
+  };
+  detail::TextCursor sizes = next_line(true);
+  std::size_t rows = sizes.ParseIndex();
+  std::size_t cols = sizes.ParseIndex();
+  std::size_t entries = coordinate ? sizes.ParseIndex() : 0;
+  sizes.EndLine();
+  if ((symmetric || skew) && rows != cols) {
+    sizes.Fail("a symmetric matrix must be square");
+  }
+  S21Matrix<T> mtx(alloc);
+  try {
+    mtx = S21Matrix<T>(rows, cols, alloc);
+  } catch (const std::bad_array_new_length&) {
+    sizes.Fail("matrix size too large");
+  }
+  T* data = mtx.Data();
+  std::size_t stride = mtx.GetStride();
+  auto store = [&](std::size_t r, std::size_t c, T value) {
+    data[r * stride + c] = value;
+    if (r != c && (symmetric || skew)) {
+      data[c * stride + r] = skew ? static_cast<T>(-value) : value;
+    }
+  };
+  if (coordinate) {
+    for (std::size_t i = 0; i < entries; ++i) {
+      detail::TextCursor cursor = next_line(false);
+      std::size_t r = cursor.ParseIndex(), c = cursor.ParseIndex();
+      if (!r || r > rows || !c || c > cols) {
+        cursor.Fail("entry (" + std::to_string(r) + ", " + std::to_string(c) +
+                    ") is outside the matrix");
+      }
+      T value = pattern ? T{1} : cursor.ParseNumber<T>();
+      cursor.EndLine();
+      store(r - 1, c - 1, value);
+    }
+  } else {
+    for (std::size_t c = 0; c < cols; ++c) {
+      std::size_t first = symmetric ? c : skew ? c + 1 : 0;
+      for (std::size_t r = first; r < rows; ++r) {
+        detail::TextCursor cursor = next_line(false);
+        T value = cursor.ParseNumber<T>();
+        cursor.EndLine();
+        store(r, c, value);
+      }
+    }
+  }
+  return mtx;
+}
+
+// files
+
+template <typename M>
+void SaveCsv(const std::string& path, const M& mtx, char delimiter = ',') {
+  std::ofstream file(path, std::ios::binary | std::ios::trunc);
+  if (!file) throw std::runtime_error("cannot open " + path);
+  WriteCsv(file, mtx, delimiter);
+}
+
+template <typename T>
+S21Matrix<T> LoadCsv(const std::string& path, char delimiter = ',',
+                     const typename S21Matrix<T>::allocator_type& alloc = {}) {
+  std::ifstream file(path, std::ios::binary);
+  if (!file) throw std::runtime_error("cannot open " + path);
+  return ReadCsv<T>(file, delimiter, alloc);
+}
+
+template <typename M>
+void SaveMatrixMarket(const std::string& path, const M& mtx) {
+  std::ofstream file(path, std::ios::binary | std::ios::trunc);
+  if (!file) throw std::runtime_error("cannot open " + path);
+  WriteMatrixMarket(file, mtx);
+}
+
+template <typename T>
+S21Matrix<T> LoadMatrixMarket(
+    const std::string& path,
+    const typename S21Matrix<T>::allocator_type& alloc = {}) {
+  std::ifstream file(path, std::ios::binary);
+  if (!file) throw std::runtime_error("cannot open " + path);
+  return ReadMatrixMarket<T>(file, alloc);
+}
+
+}  // namespace s21
+
+#endif  // S21_MATRIXPLUSPLUS_SRC_S21_MATRIX_TEXT_H_
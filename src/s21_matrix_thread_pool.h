@@ -0,0 +1,270 @@
+#ifndef S21_MATRIXPLUSPLUS_SRC_S21_MATRIX_THREAD_POOL_H_
+#define S21_MATRIXPLUSPLUS_SRC_S21_MATRIX_THREAD_POOL_H_
+
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <exception>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <thread>
+#include <utility>
+#include <vector>
+
+namespace s21 {
+
+// A fixed set of workers, each owning a task deque. A worker pops its own
+// deque from the back and, once it runs dry, steals from the front of the
+// others. Threads waiting for their tasks (ParallelFor callers) help by
+// running queued tasks too, so nested parallel calls cannot deadlock.
+class ThreadPool {
+ public:
+  using size_type = std::size_t;
+  using Task = std::function<void()>;
+
+ public:
+  explicit ThreadPool(size_type workers)
+      : _queues(std::max<size_type>(1, workers)) {
+    for (auto& queue : _queues) queue = std::make_unique<Queue>();
+    _threads.reserve(workers);
+    for (size_type i = 0; i < workers; ++i) {
+      _threads.emplace_back([this, i] { WorkerLoop(i); });
+    }
+  }
+
+  ThreadPool(const ThreadPool&) = delete;
+  ThreadPool& operator=(const ThreadPool&) = delete;
+
+  ~ThreadPool() noexcept {
+    {
+      std::lock_guard<std::mutex> lock(_sleep_mutex);
+      _stop = true;
+    }
+    _wake.notify_all();
+    for (auto& thread : _threads) thread.join();
+  }
+
+  size_type GetWorkers() const noexcept { return _threads.size(); }
+
+  // Queues a task: a worker of this pool pushes to its own deque,
+  // any other thread spreads tasks round-robin.
+  void Submit(Task task) {
+    size_type index = tls_pool == this
+                          ? tls_index
+                          : _next.fetch_add(1, std::memory_order_relaxed) %
+                                _queues.size();
+    {
+      std::lock_guard<std::mutex> lock(_queues[index]->mutex);
+      _queues[index]->tasks.push_back(std::move(task));
+    }
+    {
+      std::lock_guard<std::mutex> lock(_sleep_mutex);
+      ++_pending;
+    }
+    _wake.notify_one();
+  }
+
+  // Runs one queued task on the calling thread, if there is any.
+  bool RunPendingTask() {
+    size_type home = tls_pool == this ? tls_index : 0;
+    std::optional<Task> task = Pop(home);
+    if (!task) return false;
+    (*task)();
+    return true;
+  }
+
+  // Calls body(begin, end) for consecutive chunks of [0, n) and waits for
+  // all of them. The first exception thrown by a chunk is rethrown here.
+  template <typename F>
+  void ParallelFor(size_type n, size_type chunk, F&& body) {
+    if (!n) return;
+    chunk = std::max<size_type>(1, chunk);
+    struct State {
+      std::atomic<size_type> remaining;
+      std::mutex mutex;
+      std::exception_ptr error;
+    } state;
+    size_type chunks = (n + chunk - 1) / chunk;
+    state.remaining.store(chunks, std::memory_order_relaxed);
+    auto run = [&state, &body, n, chunk](size_type index) {
+      try {
+        size_type begin = index * chunk;
+        body(begin, std::min(n, begin + chunk));
+      } catch (...) {
+        std::lock_guard<std::mutex> lock(state.mutex);
+        if (!state.error) state.error = std::current_exception();
+      }
+      state.remaining.fetch_sub(1, std::memory_order_acq_rel);
+    };
+    for (size_type i = 1; i < chunks; ++i) {
+      Submit([&run, i] { run(i); });
+    }
+    run(0);
+    while (state.remaining.load(std::memory_order_acquire)) {
+      if (!RunPendingTask()) std::this_thread::yield();
+    }
+    if (state.error) std::rethrow_exception(state.error);
+  }
+
+ private:
+  struct Queue {
+    std::mutex mutex;
+    std::deque<Task> tasks;
+  };
+
+  std::optional<Task> Pop(size_type home) {
+    {
+      Queue& own = *_queues[home];
+      std::lock_guard<std::mutex> lock(own.mutex);
+      if (!own.tasks.empty()) {
+        Task task = std::move(own.tasks.back());
+        own.tasks.pop_back();
+        return Take(std::move(task));
+      }
+    }
+    for (size_type i = 1; i < _queues.size(); ++i) {
+      Queue& victim = *_queues[(home + i) % _queues.size()];
+      std::lock_guard<std::mutex> lock(victim.mutex);
+      if (!victim.tasks.empty()) {
+        Task task = std::move(victim.tasks.front());
+        victim.tasks.pop_front();
+        return Take(std::move(task));
+      }
+    }
+    return std::nullopt;
+  }
+
+  Task Take(Task task) {
+    std::lock_guard<std::mutex> lock(_sleep_mutex);
+    --_pending;
+    return task;
+  }
+
+  void WorkerLoop(size_type index) {
+    tls_pool = this;
+    tls_index = index;
+    for (;;) {
+      if (RunPendingTask()) continue;
+      std::unique_lock<std::mutex> lock(_sleep_mutex);
+      _wake.wait(lock, [this] { return _stop || _pending; });
+      if (_stop && !_pending) return;
+    }
+  }
+
+  static inline thread_local ThreadPool* tls_pool = nullptr;
+  static inline thread_local size_type tls_index = 0;
+
+  std::vector<std::unique_ptr<Queue>> _queues;
+  std::vector<std::thread> _threads;
+  std::atomic<size_type> _next{0};
+  std::mutex _sleep_mutex;
+  std::condition_variable _wake;
+  size_type _pending{0};
+  bool _stop{false};
+};
+
+// How S21Matrix operations use the cores: `threads` is the total number of
+// threads taking part (0 = all hardware threads, 1 = serial), and an
+// operation whose amount of work (roughly, scalar operations) is below
+// `serial_threshold` always runs serially. Results do not depend on either.
+struct ExecutionPolicy {
+  std::size_t threads = 1;
+  std::size_t serial_threshold = std::size_t{1} << 16;
+};
+
+namespace detail {
+
+struct ExecutionState {
+  std::mutex mutex;
+  ExecutionPolicy policy;
+  std::shared_ptr<ThreadPool> pool;
+};
+
+inline ExecutionState& GlobalExecution() {
+  static ExecutionState state;
+  return state;
+}
+
+inline thread_local const ExecutionPolicy* tls_policy_override = nullptr;
+
+inline std::size_t ResolveThreads(std::size_t threads) noexcept {
+  if (!threads) {
+    threads = std::max(1u, std::thread::hardware_concurrency());
+  }
+  return threads;
+}
+
+// The pool serving `threads` participants (the caller plus workers).
+inline std::shared_ptr<ThreadPool> AcquirePool(std::size_t threads) {
+  ExecutionState& state = GlobalExecution();
+  std::lock_guard<std::mutex> lock(state.mutex);
+  if (!state.pool || state.pool->GetWorkers() != threads - 1) {
+    state.pool = std::make_shared<ThreadPool>(threads - 1);
+  }
+  return state.pool;
+}
+
+}  // namespace detail
+
+inline ExecutionPolicy GetExecutionPolicy() {
+  if (detail::tls_policy_override) return *detail::tls_policy_override;
+  detail::ExecutionState& state = detail::GlobalExecution();
+  std::lock_guard<std::mutex> lock(state.mutex);
+  return state.policy;
+}
+
+// Sets the process-wide policy. Should not race with running operations
+// that need a differently sized pool.
+inline void SetExecutionPolicy(const ExecutionPolicy& policy) {
+  detail::ExecutionState& state = detail::GlobalExecution();
+  std::lock_guard<std::mutex> lock(state.mutex);
+  state.policy = policy;
+}
+
+// Overrides the policy for the operations the current thread runs
+// while the object is alive.
+class ScopedExecutionPolicy {
+ public:
+  explicit ScopedExecutionPolicy(const ExecutionPolicy& policy) noexcept
+      : _policy(policy), _saved(detail::tls_policy_override) {
+    detail::tls_policy_override = &_policy;
+  }
+
+  ScopedExecutionPolicy(const ScopedExecutionPolicy&) = delete;
+  ScopedExecutionPolicy& operator=(const ScopedExecutionPolicy&) = delete;
+
+  ~ScopedExecutionPolicy() noexcept { detail::tls_policy_override = _saved; }
+
+ private:
+  ExecutionPolicy _policy;
+  const ExecutionPolicy* _saved;
+};
+
+// Calls body(begin, end) over [0, n) according to the current policy.
+// `cost` is the work per item, `align` keeps chunk borders on multiples
+// of it (e.g. cache blocks) so the partition never splits a block.
+template <typename F>
+void ParallelFor(std::size_t n, std::size_t cost, F&& body,
+                 std::size_t align = 1) {
+  if (!n) return;
+  ExecutionPolicy policy = GetExecutionPolicy();
+  std::size_t threads = detail::ResolveThreads(policy.threads);
+  align = std::max<std::size_t>(1, align);
+  std::size_t blocks = (n + align - 1) / align;
+  if (threads < 2 || blocks < 2 || n * cost < policy.serial_threshold) {
+    body(std::size_t{0}, n);
+    return;
+  }
+  // a few chunks per thread leave room for stealing
+  std::size_t chunks = std::min(blocks, threads * 4);
+  std::size_t chunk = (blocks + chunks - 1) / chunks * align;
+  detail::AcquirePool(threads)->ParallelFor(n, chunk, body);
+}
+
+}  // namespace s21
+
+#endif  // S21_MATRIXPLUSPLUS_SRC_S21_MATRIX_THREAD_POOL_H_
@@ -0,0 +1,233 @@
+#ifndef S21_MATRIXPLUSPLUS_SRC_S21_MATRIX_TOLERANCE_H_
+#define S21_MATRIXPLUSPLUS_SRC_S21_MATRIX_TOLERANCE_H_
+
+#include <algorithm>
+#include <atomic>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <limits>
+#include <type_traits>
+
+#include "s21_matrix_simd.h"
+#include "s21_matrix_thread_pool.h"
+
+// Tolerance policies of EqMatrix(other, tolerance). The policy is a type,
+// so the comparison of a pair of elements is inlined into the kernel that
+// scans the matrices; the kernel exits at the first chunk of elements
+// with one out of tolerance. Integers are compared exactly by their
+// difference, never through floating point.
+namespace s21 {
+
+// |a - b| <= eps. A NaN difference is not greater than eps either, so
+// NaN elements compare equal to anything.
+struct AbsoluteTolerance {
+  double eps = std::numeric_limits<double>::epsilon();
+};
+
+// |a - b| <= max(abs, rel * max(|a|, |b|)). NaN is never within.
+struct RelativeTolerance {
+  double rel = 1e-9;
+  double abs = 0.0;
+};
+
+// a and b at most `ulps` representable values apart, so -0 and +0 are
+// equal and NaN is never within. The distance is exact for float, double
+// and integers; for long double it is measured in ulps of the larger
+// magnitude.
+struct UlpTolerance {
+  std::uint64_t ulps = 4;
+};
+
+// What EqMatrix(other) and == check: the epsilon of the element type, so
+// float elements may differ by one float ulp at 1 and integers not at all.
+template <typename T>
+constexpr AbsoluteTolerance DefaultTolerance() noexcept {
+  return AbsoluteTolerance{
+      static_cast<double>(std::numeric_limits<T>::epsilon())};
+}
+
+template <typename P>
+inline constexpr bool kIsTolerance =
+    std::is_same_v<P, AbsoluteTolerance> ||
+    std::is_same_v<P, RelativeTolerance> || std::is_same_v<P, UlpTolerance>;
+
+template <typename P>
+using EnableIfTolerance = std::enable_if_t<kIsTolerance<P>>;
+
+namespace detail {
+
+// |a - b| of integers without overflow
+template <typename T>
+unsigned long long AbsDiff(T a, T b) noexcept {
+  using U = unsigned long long;
+  return a > b ? static_cast<U>(a) - static_cast<U>(b)
+               : static_cast<U>(b) - static_cast<U>(a);
+}
+
+// the bits of x as an integer that grows with x, -0 and +0 both at 0
+template <typename T>
+auto OrderedBits(T x) noexcept {
+  using I = std::conditional_t<sizeof(T) == 4, std::int32_t, std::int64_t>;
+  I bits;
+  std::memcpy(&bits, &x, sizeof(bits));
+  return bits < 0 ? std::numeric_limits<I>::min() - bits : bits;
+}
+
+template <typename T>
+bool Within(T a, T b, const AbsoluteTolerance& tol) noexcept {
+  if constexpr (std::is_integral_v<T>) {
+    return AbsDiff(a, b) <= tol.eps;
+  } else {
+    return !(std::fabs(a - b) > tol.eps);
+  }
+}
+
+template <typename T>
+bool Within(T a, T b, const RelativeTolerance& tol) noexcept {
+  using R = std::conditional_t<std::is_floating_point_v<T>, T, double>;
+  R x = static_cast<R>(a), y = static_cast<R>(b);
+  R diff;
+  if constexpr (std::is_integral_v<T>) {
+    diff = static_cast<R>(AbsDiff(a, b));
+  } else {
+    diff = std::fabs(x - y);
+  }
+  R larger = std::fabs(x) < std::fabs(y) ? std::fabs(y) : std::fabs(x);
+  R scaled = static_cast<R>(tol.rel) * larger;
+  R floor = static_cast<R>(tol.abs);
+  R bound = scaled < floor ? floor : scaled;
+  // bitwise operators keep the loops over chunks free of branches
+  return (x == y) | (diff <= bound);
+}
+
+template <typename T>
+bool Within(T a, T b, const UlpTolerance& tol) noexcept {
+  if constexpr (std::is_integral_v<T>) {
+    return AbsDiff(a, b) <= tol.ulps;
+  } else if constexpr (std::is_same_v<T, float> || std::is_same_v<T, double>) {
+    auto x = OrderedBits(a), y = OrderedBits(b);
+    using U = std::make_unsigned_t<decltype(x)>;
+    U dist = x > y ? static_cast<U>(x) - static_cast<U>(y)
+                   : static_cast<U>(y) - static_cast<U>(x);
+    return (a == a) & (b == b) & (dist <= tol.ulps);
+  } else {
+    if (a == b) return true;
+    T larger = std::max(std::fabs(a), std::fabs(b));
+    T ulp =
+        std::nextafter(larger, std::numeric_limits<T>::infinity()) - larger;
+    return std::fabs(a - b) <= ulp * static_cast<T>(tol.ulps);
+  }
+}
+
+// Whether all n pairs are within `tol`, checked a chunk at a time: the
+// loop over a chunk has no branch and vectorises at -O3, the check
+// between chunks exits early.
+template <typename T, typename Tolerance>
+bool AllWithinScalar(const T* lhs, const T* rhs, std::size_t n,
+                     const Tolerance& tol) noexcept {
+  constexpr std::size_t kChunk = 4 * 64 / sizeof(T);
+  std::size_t i = 0;
+  for (; i + kChunk <= n; i += kChunk) {
+    unsigned outside = 0;
+    for (std::size_t j = 0; j < kChunk; ++j) {
+      outside |= !Within(lhs[i + j], rhs[i + j], tol);
+    }
+    if (outside) return false;
+  }
+  for (; i < n; ++i) {
+    if (!Within(lhs[i], rhs[i], tol)) return false;
+  }
+  return true;
+}
+
+#if defined(S21_MATRIX_SIMD_X86)
+
+// the same loop compiled for wider vector registers
+template <typename T, typename Tolerance>
+__attribute__((target("avx2"))) bool AllWithinAvx2(
+    const T* lhs, const T* rhs, std::size_t n, const Tolerance& tol) noexcept {
+  return AllWithinScalar(lhs, rhs, n, tol);
+}
+
+template <typename T, typename Tolerance>
+__attribute__((target("avx512f,avx512bw"))) bool AllWithinAvx512(
+    const T* lhs, const T* rhs, std::size_t n, const Tolerance& tol) noexcept {
+  return AllWithinScalar(lhs, rhs, n, tol);
+}
+
+#endif  // S21_MATRIX_SIMD_X86
+
+// the absolute check of the element-wise kernels, written with intrinsics
+template <typename T>
+bool AllWithinAbsolute(const T* lhs, const T* rhs, std::size_t n,
+                       const AbsoluteTolerance& tol) noexcept {
+  return simd::Kernels<T>().equal(lhs, rhs, n, tol.eps);
+}
+
+template <typename T, typename Tolerance>
+using WithinKernel = bool (*)(const T*, const T*, std::size_t,
+                              const Tolerance&) noexcept;
+
+// The kernel for the active instruction set.
+template <typename T, typename Tolerance>
+WithinKernel<T, Tolerance> SelectWithinKernel(const Tolerance& tol) noexcept {
+  if constexpr (std::is_same_v<Tolerance, AbsoluteTolerance>) {
+    // the integer kernels compare bytes, right while eps is below 1
+    if (!std::is_integral_v<T> || tol.eps < 1) return AllWithinAbsolute<T>;
+  } else {
+    (void)tol;
+  }
+#if defined(S21_MATRIX_SIMD_X86)
+  if constexpr (simd::kIsVectorizable<T>) {
+    switch (simd::ActiveIsa()) {
+      case simd::Isa::kAvx512:
+        return AllWithinAvx512<T, Tolerance>;
+      case simd::Isa::kAvx2:
+        return AllWithinAvx2<T, Tolerance>;
+      default:
+        break;
+    }
+  }
+#endif
+  return AllWithinScalar<T, Tolerance>;
+}
+
+// Whether the rows x cols blocks at lhs and rhs, with rows ldl and ldr
+// elements apart, are within `tol` everywhere. The blocks are scanned in
+// pieces spread across threads by the execution policy; a mismatch stops
+// the other threads at their next piece.
+template <typename T, typename Tolerance>
+bool AllWithin(std::size_t rows, std::size_t cols, const T* lhs,
+               std::size_t ldl, const T* rhs, std::size_t ldr,
+               const Tolerance& tol) {
+  if (!rows || !cols) return true;
+  WithinKernel<T, Tolerance> kernel = SelectWithinKernel<T>(tol);
+  if (ldl == cols && ldr == cols) {
+    cols *= rows;
+    rows = 1;
+  }
+  constexpr std::size_t kPiece = 4096;
+  std::size_t pieces = (cols + kPiece - 1) / kPiece;
+  std::atomic<bool> within{true};
+  s21::ParallelFor(
+      rows * pieces, std::min(cols, kPiece),
+      [&](std::size_t begin, std::size_t end) {
+        for (std::size_t p = begin; p < end; ++p) {
+          if (!within.load(std::memory_order_relaxed)) return;
+          std::size_t r = p / pieces, c = p % pieces * kPiece;
+          if (!kernel(lhs + r * ldl + c, rhs + r * ldr + c,
+                      std::min(kPiece, cols - c), tol)) {
+            within.store(false, std::memory_order_relaxed);
+            return;
+          }
+        }
+      });
+  return within.load(std::memory_order_relaxed);
+}
+
+}  // namespace detail
+}  // namespace s21
+
+#endif  // S21_MATRIXPLUSPLUS_SRC_S21_MATRIX_TOLERANCE_H_
@@ -0,0 +1,31 @@
+#ifndef S21_MATRIXPLUSPLUS_SRC_S21_MATRIX_TRAITS_H_
+#define S21_MATRIXPLUSPLUS_SRC_S21_MATRIX_TRAITS_H_
+
+#include <type_traits>
+
+// Element types of mixed-type operations.
+namespace s21 {
+
+// The element type of an operation on matrices of T and U, by the usual
+// arithmetic conversions: float and double give double, int and float
+// give float.
+template <typename T, typename U>
+using Promoted = std::common_type_t<T, U>;
+
+// The type sums of products of T are accumulated in when no accumulator
+// is named explicitly, as in MulMatrix<double>() of a float matrix.
+// It is T itself, which keeps float products in float vector registers.
+// A program may specialise it, e.g. for float to double, to trade speed
+// for accuracy everywhere; the specialisation must then be visible in
+// every translation unit that multiplies matrices of that type.
+template <typename T>
+struct Accumulator {
+  using type = T;
+};
+
+template <typename T>
+using AccumulatorOf = typename Accumulator<T>::type;
+
+}  // namespace s21
+
+#endif  // S21_MATRIXPLUSPLUS_SRC_S21_MATRIX_TRAITS_H_
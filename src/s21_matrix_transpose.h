@@ -0,0 +1,112 @@
+#ifndef S21_MATRIXPLUSPLUS_SRC_S21_MATRIX_TRANSPOSE_H_
+#define S21_MATRIXPLUSPLUS_SRC_S21_MATRIX_TRANSPOSE_H_
+
+#include <cstddef>
+#include <utility>
+
+#include "s21_matrix_thread_pool.h"
+
+// Cache-oblivious transposition of row-major buffers. Halving the longer
+// side until a block fits in a tile keeps both the reads and the strided
+// writes of a leaf inside L1 on any cache hierarchy, with no tuning.
+namespace s21 {
+namespace detail {
+
+// Leaf blocks are at most kTransposeTile x kTransposeTile when copying.
+// Swapping leaves access both blocks with a stride, so they are kept
+// smaller: with power-of-two strides their lines compete for few L1 sets.
+inline constexpr std::size_t kTransposeTile = 32;
+inline constexpr std::size_t kSwapTile = 8;
+
+// dst[c][r] = src[r][c] for a rows x cols block of src
+template <typename T>
+void TransposeBlock(const T* src, std::size_t lds, T* dst, std::size_t ldd,
+                    std::size_t rows, std::size_t cols) noexcept {
+  if (rows <= kTransposeTile && cols <= kTransposeTile) {
+    // strided reads are cheaper than strided writes
+    for (std::size_t c = 0; c < cols; ++c) {
+      T* row = dst + c * ldd;
+      for (std::size_t r = 0; r < rows; ++r) row[r] = src[r * lds + c];
+    }
+  } else if (rows >= cols) {
+    std::size_t half = rows / 2;
+    TransposeBlock(src, lds, dst, ldd, half, cols);
+    TransposeBlock(src + half * lds, lds, dst + half, ldd, rows - half, cols);
+  } else {
+    std::size_t half = cols / 2;
+    TransposeBlock(src, lds, dst, ldd, rows, half);
+    TransposeBlock(src + half, lds, dst + half * ldd, ldd, rows, cols - half);
+  }
+}
+
+// swaps x[r][c] with y[c][r] for a rows x cols block x and a cols x rows
+// block y that do not overlap
+template <typename T>
+void SwapTransposedBlocks(T* x, T* y, std::size_t ld, std::size_t rows,
+                          std::size_t cols) noexcept {
+  if (rows <= kSwapTile && cols <= kSwapTile) {
+    for (std::size_t r = 0; r < rows; ++r) {
+      T* row = x + r * ld;
+      for (std::size_t c = 0; c < cols; ++c) std::swap(row[c], y[c * ld + r]);
+    }
+  } else if (rows >= cols) {
+    std::size_t half = rows / 2;
+    SwapTransposedBlocks(x, y, ld, half, cols);
+    SwapTransposedBlocks(x + half * ld, y + half, ld, rows - half, cols);
+  } else {
+    std::size_t half = cols / 2;
+    SwapTransposedBlocks(x, y, ld, rows, half);
+    SwapTransposedBlocks(x + half, y + half * ld, ld, rows, cols - half);
+  }
+}
+
+// transposes the n x n block on the diagonal of `a` in place
+template <typename T>
+void TransposeDiagonalBlock(T* a, std::size_t ld, std::size_t n) noexcept {
+  if (n <= kSwapTile) {
+    for (std::size_t r = 0; r < n; ++r) {
+      for (std::size_t c = r + 1; c < n; ++c) {
+        std::swap(a[r * ld + c], a[c * ld + r]);
+      }
+    }
+    return;
+  }
+  std::size_t half = n / 2;
+  TransposeDiagonalBlock(a, ld, half);
+  TransposeDiagonalBlock(a + half * ld + half, ld, n - half);
+  SwapTransposedBlocks(a + half * ld, a + half, ld, n - half, half);
+}
+
+// dst (cols x rows, leading dimension ldd) = src^T (rows x cols, lds);
+// threads take whole tiles of source rows.
+template <typename T>
+void Transpose(const T* src, std::size_t lds, T* dst, std::size_t ldd,
+               std::size_t rows, std::size_t cols) {
+  s21::ParallelFor(
+      rows, cols,
+      [&](std::size_t begin, std::size_t end) {
+        TransposeBlock(src + begin * lds, lds, dst + begin, ldd, end - begin,
+                       cols);
+      },
+      kTransposeTile);
+}
+
+// Transposes the n x n matrix `a` in place. A strip of rows [begin, end)
+// owns its diagonal block, the block to the left of it and the mirrored
+// block above the diagonal, so strips never touch the same elements.
+template <typename T>
+void TransposeInPlace(T* a, std::size_t ld, std::size_t n) {
+  s21::ParallelFor(
+      n, n,
+      [&](std::size_t begin, std::size_t end) {
+        TransposeDiagonalBlock(a + begin * ld + begin, ld, end - begin);
+        SwapTransposedBlocks(a + begin * ld, a + begin, ld, end - begin,
+                             begin);
+      },
+      kTransposeTile);
+}
+
+}  // namespace detail
+}  // namespace s21
+
+#endif  // S21_MATRIXPLUSPLUS_SRC_S21_MATRIX_TRANSPOSE_H_
@@ -0,0 +1,456 @@
+#ifndef S21_MATRIXPLUSPLUS_SRC_S21_MATRIX_VIEW_H_
+#define S21_MATRIXPLUSPLUS_SRC_S21_MATRIX_VIEW_H_
+
+#include <algorithm>
+#include <cassert>
+#include <cmath>
+#include <cstddef>
+#include <iostream>
+#include <memory_resource>
+#include <stdexcept>
+#include <string>
+#include <tuple>
+#include <type_traits>
+#include <vector>
+
+#include "s21_matrix_expression.h"
+#include "s21_matrix_gemm.h"
+#include "s21_matrix_reduce.h"
+#include "s21_matrix_simd.h"
+#include "s21_matrix_thread_pool.h"
+#include "s21_matrix_tolerance.h"
+#include "s21_matrix_transpose.h"
+
+template <typename T,
+          typename =
+              typename std::enable_if<std::is_arithmetic<T>::value, T>::type>
+class S21Matrix;
+
+// A non-owning rows x cols window into row-major storage whose rows are
+// `stride` elements apart: a whole S21Matrix, a block, a row or a column
+// of one, or any external buffer. Like std::span, a view is cheap to copy
+// and does not extend the life of the storage it refers to; a view of
+// `const T` is read-only.
+// Views are operands of every S21Matrix operation and leaves of the
+// expression templates. Element-wise operations and assignment write
+// through the view into the underlying storage; operations with a
+// differently shaped result (products, transposes, inverses) return a new
+// S21Matrix allocated from the view's memory resource. Writing to a view
+// from a view of overlapping storage is only safe when the elements
+// coincide exactly.
+template <typename T>
+class S21MatrixView : public s21::MatrixExpression<S21MatrixView<T>> {
+ public:
+  using value_type = std::remove_const_t<T>;
+  using size_type = std::size_t;
+  using pointer = T*;
+  using reference = T&;
+  using accumulator_type = s21::AccumulatorOf<value_type>;
+  using sum_type = s21::SumOf<value_type>;
+  using norm_type = s21::NormOf<value_type>;
+  static constexpr bool kIsExpressionLeaf = true;
+
+  static_assert(std::is_arithmetic_v<value_type>,
+                "a view refers to arithmetic elements");
+
+ public:
+  S21MatrixView() noexcept = default;
+
+  S21MatrixView(T* data, size_type rows, size_type cols, size_type stride,
+                std::pmr::memory_resource* resource =
+                    std::pmr::get_default_resource()) noexcept
+      : _data(data),
+        _rows(rows),
+        _cols(cols),
+        _stride(stride),
+        _resource(resource) {}
+
+  // a dense buffer
+  S21MatrixView(T* data, size_type rows, size_type cols) noexcept
+      : S21MatrixView(data, rows, cols, cols) {}
+
+  S21MatrixView(const S21MatrixView&) noexcept = default;
+
+  // a mutable view converts to a read-only one
+  template <typename U,
+            typename = std::enable_if_t<std::is_same_v<const U, T> &&
+                                        !std::is_same_v<U, T>>>
+  S21MatrixView(const S21MatrixView<U>& other) noexcept
+      : S21MatrixView(other.Data(), other.GetRows(), other.GetCols(),
+                      other.GetStride(), other.GetResource()) {}
+
+  // Assignment copies the elements, not the view: the shapes must match.
+  // Read-only views cannot be assigned.
+  S21MatrixView& operator=(const S21MatrixView& other) {
+    return Assign(other);
+  }
+
+  template <typename E, typename = std::enable_if_t<
+                            std::is_same_v<typename E::value_type, value_type>>>
+  S21MatrixView& operator=(const s21::MatrixExpression<E>& expr) {
+    return Assign(expr.Self());
+  }
+
+  // main operations
+
+  bool EqMatrix(const S21MatrixView<const value_type>& other) const {
+    return EqMatrix(other, s21::DefaultTolerance<value_type>());
+  }
+
+  // element by element within `tolerance` (s21_matrix_tolerance.h)
+  template <typename Tolerance, typename = s21::EnableIfTolerance<Tolerance>>
+  bool EqMatrix(const S21MatrixView<const value_type>& other,
+                const Tolerance& tolerance) const {
+    if (_rows != other.GetRows() || _cols != other.GetCols()) return false;
+    return s21::detail::AllWithin(_rows, _cols, Data(), _stride, other.Data(),
+                                  other.GetStride(), tolerance);
+  }
+
+  void SumMatrix(const S21MatrixView<const value_type>& other) const {
+    CheckIsWritable();
+    CheckIsEqualSize(other);
+    const auto& kernels = s21::simd::Kernels<value_type>();
+    ForEachRow(
+        [&](size_type r) { kernels.sum(RowData(r), other.RowData(r), _cols); });
+  }
+
+  void SubMatrix(const S21MatrixView<const value_type>& other) const {
+    CheckIsWritable();
+    CheckIsEqualSize(other);
+    const auto& kernels = s21::simd::Kernels<value_type>();
+    ForEachRow(
+        [&](size_type r) { kernels.sub(RowData(r), other.RowData(r), _cols); });
+  }
+
+  void MulNumber(long double num) const {
+    CheckIsWritable();
+    const auto& kernels = s21::simd::Kernels<value_type>();
+    ForEachRow([&](size_type r) { kernels.scale(RowData(r), _cols, num); });
+  }
+
+  // This * other, read straight from both views. The products are summed
+  // in Acc and rounded to value_type once at the end: MulMatrix<double>()
+  // of float views packs the operands into double.
+  template <typename Acc = s21::AccumulatorOf<value_type>>
+  S21Matrix<value_type> MulMatrix(
+      const S21MatrixView<const value_type>& other) const {
+    if (_cols != other.GetRows()) {
+      std::string errmsg = std::string("this cols (") + std::to_string(_cols) +
+                           std::string(" != other rows (") +
+                           std::to_string(other.GetRows()) + std::string(")");
+      throw std::logic_error(errmsg);
+    }
+    S21Matrix<Acc> mtx(_rows, other.GetCols(), _resource);
+    s21::detail::Gemm(_rows, other.GetCols(), _cols, _data, _stride,
+                      other.Data(), other.GetStride(), mtx.Data(),
+                      mtx.GetStride());
+    if constexpr (std::is_same_v<Acc, value_type>) {
+      return mtx;
+    } else {
+      return S21Matrix<value_type>(mtx, _resource);
+    }
+  }
+
+  S21Matrix<value_type> Transpose() const {
+    S21Matrix<value_type> mtx(_cols, _rows, _resource);
+    s21::detail::Transpose(_data, _stride, mtx.Data(), mtx.GetStride(), _rows,
+                           _cols);
+    return mtx;
+  }
+
+  // The factorisations behind these work on a private copy anyway.
+  S21Matrix<value_type> CalcComplements() const {
+    return ToMatrix().CalcComplements();
+  }
+  long double Determinant() const { return ToMatrix().Determinant(); }
+  S21Matrix<value_type> InverseMatrix() const {
+    return ToMatrix().InverseMatrix();
+  }
+
+  S21Matrix<value_type> ToMatrix() const {
+    return S21Matrix<value_type>(*this, _resource);
+  }
+
+  // reductions (s21_matrix_reduce.h)
+
+  sum_type Sum() const {
+    const auto& kernels = s21::detail::Reductions<value_type>();
+    return s21::detail::SumPieces<sum_type>(
+        _rows, _cols, IsDense(), [&](size_type r, size_type c, size_type n) {
+          return kernels.sum(RowData(r) + c, n);
+        });
+  }
+
+  sum_type Trace() const {
+    CheckIsSquare();
+    return s21::detail::PairwiseSum<sum_type>(
+        _rows, [this](size_type i) {
+          return static_cast<sum_type>(_data[i * (_stride + 1)]);
+        });
+  }
+
+  // the sum of the element-wise products with a view of the same shape
+  sum_type Dot(const S21MatrixView<const value_type>& other) const {
+    CheckIsEqualSize(other);
+    const auto& kernels = s21::detail::Reductions<value_type>();
+    bool dense = IsDense() && other.GetStride() == _cols;
+    return s21::detail::SumPieces<sum_type>(
+        _rows, _cols, dense, [&](size_type r, size_type c, size_type n) {
+          return kernels.dot(RowData(r) + c, other.RowData(r) + c, n);
+        });
+  }
+
+  norm_type NormFrobenius() const {
+    const auto& kernels = s21::detail::Reductions<value_type>();
+    return std::sqrt(s21::detail::SumPieces<norm_type>(
+        _rows, _cols, IsDense(), [&](size_type r, size_type c, size_type n) {
+          return kernels.sum_squares(RowData(r) + c, n);
+        }));
+  }
+
+  // the largest sum of magnitudes in a column
+  norm_type Norm1() const {
+    if (!_rows || !_cols) return norm_type{};
+    std::vector<norm_type> sums(_cols);
+    s21::detail::SumColumns(_rows, _cols, _data, _stride,
+                            s21::detail::Reductions<value_type>().add_abs,
+                            sums.data());
+    return *std::max_element(sums.begin(), sums.end());
+  }
+
+  // the largest sum of magnitudes in a row
+  norm_type NormInf() const {
+    if (!_rows || !_cols) return norm_type{};
+    const auto& kernels = s21::detail::Reductions<value_type>();
+    std::vector<norm_type> sums(_rows);
+    ForEachRow(
+        [&](size_type r) { sums[r] = kernels.sum_abs(RowData(r), _cols); });
+    return *std::max_element(sums.begin(), sums.end());
+  }
+
+  // Extrema of a nonempty view, std::out_of_range otherwise. With NaN
+  // elements the result is unspecified.
+  value_type Min() const {
+    CheckIsNotEmpty();
+    const auto& kernels = s21::detail::Reductions<value_type>();
+    return s21::detail::PickPieces<value_type>(
+        _rows, _cols, IsDense(),
+        [&](size_type r, size_type c, size_type n) {
+          return kernels.min(RowData(r) + c, n);
+        },
+        [](value_type a, value_type b) { return a < b ? a : b; });
+  }
+
+  value_type Max() const {
+    CheckIsNotEmpty();
+    const auto& kernels = s21::detail::Reductions<value_type>();
+    return s21::detail::PickPieces<value_type>(
+        _rows, _cols, IsDense(),
+        [&](size_type r, size_type c, size_type n) {
+          return kernels.max(RowData(r) + c, n);
+        },
+        [](value_type a, value_type b) { return b < a ? a : b; });
+  }
+
+  // (row, col) of the first extremum in row-major order
+  std::tuple<size_type, size_type> ArgMin() const { return Find(Min()); }
+  std::tuple<size_type, size_type> ArgMax() const { return Find(Max()); }
+
+  // the rows x 1 sums of the rows and the 1 x cols sums of the columns
+  S21Matrix<sum_type> RowSums() const {
+    const auto& kernels = s21::detail::Reductions<value_type>();
+    S21Matrix<sum_type> mtx(_rows, 1, _resource);
+    ForEachRow([&](size_type r) {
+      *mtx.RowData(r) = kernels.sum(RowData(r), _cols);
+    });
+    return mtx;
+  }
+
+  S21Matrix<sum_type> ColSums() const {
+    S21Matrix<sum_type> mtx(1, _cols, _resource);
+    s21::detail::SumColumns(_rows, _cols, _data, _stride,
+                            s21::detail::Reductions<value_type>().add,
+                            mtx.Data());
+    return mtx;
+  }
+
+  // slicing
+
+  // the rows x cols block whose top left element is (row, col)
+  S21MatrixView Block(size_type row, size_type col, size_type rows,
+                      size_type cols) const {
+    CheckBlock(row, col, rows, cols);
+    return S21MatrixView(_data + row * _stride + col, rows, cols, _stride,
+                         _resource);
+  }
+
+  S21MatrixView Row(size_type row) const { return Block(row, 0, 1, _cols); }
+  S21MatrixView Col(size_type col) const { return Block(0, col, _rows, 1); }
+
+  // getters
+  size_type GetRows() const noexcept { return _rows; }
+  size_type GetCols() const noexcept { return _cols; }
+  size_type GetStride() const noexcept { return _stride; }
+  T* Data() const noexcept { return _data; }
+  std::pmr::memory_resource* GetResource() const noexcept { return _resource; }
+  bool IsSquare() const noexcept { return _rows == _cols; }
+
+  // operators
+
+  bool operator==(const S21MatrixView<const value_type>& other) const {
+    return EqMatrix(other);
+  }
+
+  const S21MatrixView& operator+=(
+      const S21MatrixView<const value_type>& other) const {
+    SumMatrix(other);
+    return *this;
+  }
+
+  const S21MatrixView& operator-=(
+      const S21MatrixView<const value_type>& other) const {
+    SubMatrix(other);
+    return *this;
+  }
+
+  const S21MatrixView& operator*=(long double num) const {
+    MulNumber(num);
+    return *this;
+  }
+
+  S21Matrix<value_type> operator*(
+      const S21MatrixView<const value_type>& other) const {
+    return MulMatrix(other);
+  }
+
+  // unchecked element read, the leaf of the expression templates
+  value_type Eval(size_type row, size_type col) const noexcept {
+    return _data[row * _stride + col];
+  }
+
+  // checked unless built with S21_MATRIX_NO_BOUNDS_CHECK, as for S21Matrix
+  reference operator()(size_type row, size_type col) const {
+#ifndef S21_MATRIX_NO_BOUNDS_CHECK
+    CheckIndexUpperBound(row, _rows);
+    CheckIndexUpperBound(col, _cols);
+#endif
+    return AtUnchecked(row, col);
+  }
+
+  // indices are only asserted, in debug builds
+  reference AtUnchecked(size_type row, size_type col) const noexcept {
+    assert(row < _rows && col < _cols);
+    return _data[row * _stride + col];
+  }
+
+  T* RowData(size_type row) const noexcept { return _data + row * _stride; }
+
+  friend std::ostream& operator<<(std::ostream& os, const S21MatrixView& view) {
+    return os << view.ToMatrix();
+  }
+
+ private:
+  template <typename F>
+  void ForEachRow(F&& body) const {
+    s21::ParallelFor(_rows, _cols, [&](size_type begin, size_type end) {
+      for (size_type r = begin; r < end; ++r) body(r);
+    });
+  }
+
+  template <typename E>
+  S21MatrixView& Assign(const E& expr) {
+    CheckIsWritable();
+    if (_rows != expr.GetRows() || _cols != expr.GetCols()) {
+      throw std::logic_error(
+          std::string("Size mismatch: this ") +
+          s21::detail::DimString(_rows, _cols) + " != other " +
+          s21::detail::DimString(expr.GetRows(), expr.GetCols()));
+    }
+    ForEachRow([&](size_type r) {
+      T* row = RowData(r);
+      for (size_type c = 0; c < _cols; ++c) row[c] = expr.Eval(r, c);
+    });
+    return *this;
+  }
+
+  bool IsDense() const noexcept { return _stride == _cols; }
+
+  std::tuple<size_type, size_type> Find(value_type value) const {
+    auto same = [value](value_type x) {
+      if constexpr (std::is_floating_point_v<value_type>) {
+        // a NaN extremum is found at the first NaN
+        return x == value || (std::isnan(x) && std::isnan(value));
+      } else {
+        return x == value;
+      }
+    };
+    for (size_type r = 0; r < _rows; ++r) {
+      const value_type* row = RowData(r);
+      const value_type* it = std::find_if(row, row + _cols, same);
+      if (it != row + _cols) return {r, static_cast<size_type>(it - row)};
+    }
+    return {0, 0};
+  }
+
+  static constexpr void CheckIsWritable() noexcept {
+    static_assert(!std::is_const_v<T>, "the view is read-only");
+  }
+
+  void CheckIsEqualSize(const S21MatrixView<const value_type>& other) const {
+    if (_rows != other.GetRows() || _cols != other.GetCols()) {
+      throw std::logic_error(
+          std::string("Size mismatch: this ") +
+          s21::detail::DimString(_rows, _cols) + " != other " +
+          s21::detail::DimString(other.GetRows(), other.GetCols()));
+    }
+  }
+
+  void CheckIsSquare() const {
+    if (!IsSquare()) {
+      throw std::logic_error(std::string("rows = ") + std::to_string(_rows) +
+                             " is not equal to cols = " +
+                             std::to_string(_cols));
+    }
+  }
+
+  void CheckIsNotEmpty() const {
+    if (!_rows || !_cols) {
+      throw std::out_of_range("empty matrix");
+    }
+  }
+
+  static void CheckIndexUpperBound(size_type idx, size_type upper) {
+    if (idx >= upper) {
+      std::string errmsg = "index ";
+      errmsg += std::to_string(idx);
+      errmsg += " >= ";
+      errmsg += std::to_string(upper);
+      throw std::out_of_range(errmsg);
+    }
+  }
+
+  void CheckBlock(size_type row, size_type col, size_type rows,
+                  size_type cols) const {
+    if (row > _rows || rows > _rows - row || col > _cols ||
+        cols > _cols - col) {
+      throw std::out_of_range(
+          std::string("block ") + s21::detail::DimString(rows, cols) +
+          " at " + s21::detail::DimString(row, col) + " exceeds " +
+          s21::detail::DimString(_rows, _cols));
+    }
+  }
+
+  T* _data{nullptr};
+  size_type _rows{0}, _cols{0};
+  size_type _stride{0};
+  std::pmr::memory_resource* _resource{std::pmr::get_default_resource()};
+};
+
+namespace s21 {
+
+template <typename T>
+inline constexpr bool kIsMatrixView<S21MatrixView<T>> = true;
+
+}  // namespace s21
+
+#endif  // S21_MATRIXPLUSPLUS_SRC_S21_MATRIX_VIEW_H_
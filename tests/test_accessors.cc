@@ -117,3 +117,102 @@ TEST(MatrixAccessors, SetDim) {
   ASSERT_EQ(mtx.GetRows(), 0);
   ASSERT_EQ(mtx.GetCols(), 0);
 }
+
+TEST(MatrixAccessors, AtUnchecked) {
+  S21Matrix<double> mtx(3, 20);
+  for (size_t r = 0; r < 3; ++r) {
+    for (size_t c = 0; c < 20; ++c) mtx.AtUnchecked(r, c) = r * 100.0 + c;
+  }
+  const S21Matrix<double>& cref = mtx;
+  for (size_t r = 0; r < 3; ++r) {
+    const double* row = cref.RowData(r);
+    for (size_t c = 0; c < 20; ++c) {
+      ASSERT_EQ(cref.AtUnchecked(r, c), mtx(r, c));
+      ASSERT_EQ(row[c], r * 100.0 + c);
+    }
+  }
+  ASSERT_EQ(mtx.RowData(2), &mtx(2, 0));
+  ASSERT_EQ(mtx.View().AtUnchecked(1, 5), 105.0);
+}
+
+TEST(MatrixAccessors, SetDimKeepsTopLeftBlock) {
+  S21Matrix<int> mtx(3, 17);
+  for (size_t r = 0; r < 3; ++r) {
+    for (size_t c = 0; c < 17; ++c) mtx(r, c) = r * 17 + c;
+  }
+  mtx.SetDim(5, 2);
+  ASSERT_EQ(mtx.GetDim(), std::make_tuple(5, 2));
+  for (size_t r = 0; r < 5; ++r) {
+    for (size_t c = 0; c < 2; ++c) {
+      ASSERT_EQ(mtx(r, c), r < 3 ? static_cast<int>(r * 17 + c) : 0);
+    }
+  }
+}
+
+TEST(MatrixAccessors, ResizesWithinCapacityAreInPlace) {
+  // rows of 40 doubles fill whole cache lines, 13 and 30 are padded
+  S21Matrix<double> mtx(30, 40);
+  for (size_t r = 0; r < 30; ++r) {
+    for (size_t c = 0; c < 40; ++c) mtx(r, c) = r * 100.0 + c;
+  }
+  const double* data = mtx.Data();
+  auto expect_block = [&mtx](size_t rows, size_t cols) {
+    for (size_t r = 0; r < mtx.GetRows(); ++r) {
+      for (size_t c = 0; c < mtx.GetCols(); ++c) {
+        double expected = r < rows && c < cols ? r * 100.0 + c : 0.0;
+        ASSERT_EQ(mtx(r, c), expected) << r << ", " << c;
+      }
+    }
+  };
+
+  mtx.SetDim(20, 13);  // narrower stride: rows move to the front
+  ASSERT_EQ(mtx.Data(), data);
+  expect_block(20, 13);
+  mtx.SetDim(25, 30);  // wider again: rows move back from the end
+  ASSERT_EQ(mtx.Data(), data);
+  expect_block(20, 13);
+  mtx.SetRows(30);
+  ASSERT_EQ(mtx.Data(), data);
+  ASSERT_EQ(mtx.GetCapacity(), 30 * 40 / mtx.GetStride());
+
+  mtx.SetCols(100);  // beyond the capacity
+  ASSERT_NE(mtx.Data(), data);
+  expect_block(20, 13);
+}
+
+TEST(MatrixAccessors, ReserveShrinkToFitAndAppendRow) {
+  S21Matrix<int> mtx(0, 3);
+  mtx.Reserve(100);
+  ASSERT_GE(mtx.GetCapacity(), 100u);
+  const int* data = mtx.Data();
+  for (int i = 0; i < 100; ++i) {
+    int* row = mtx.AppendRow();
+    row[0] = i, row[1] = 2 * i, row[2] = 3 * i;
+  }
+  ASSERT_EQ(mtx.Data(), data);
+  ASSERT_EQ(mtx.GetRows(), 100u);
+  ASSERT_EQ(mtx(99, 2), 297);
+
+  // appending past the capacity reallocates geometrically
+  size_t reallocations = 0;
+  for (int i = 0; i < 10000; ++i) {
+    mtx.AppendRow(mtx.Row(i));  // a row of the matrix itself
+    if (mtx.Data() != data) ++reallocations, data = mtx.Data();
+  }
+  ASSERT_LE(reallocations, 8u);
+  ASSERT_EQ(mtx.GetRows(), 10100u);
+  ASSERT_EQ(mtx(10099, 1), mtx(9999, 1));
+
+  mtx.SetRows(10);
+  ASSERT_EQ(mtx.Data(), data);
+  mtx.ShrinkToFit();
+  ASSERT_EQ(mtx.GetCapacity(), 10u);
+  ASSERT_EQ(mtx(9, 2), 27);
+
+  ASSERT_THROW(mtx.AppendRow(S21Matrix<int>(1, 4)), std::logic_error);
+  ASSERT_THROW(mtx.AppendRow(S21Matrix<int>(2, 3)), std::logic_error);
+
+  S21Matrix<int> empty;
+  empty.AppendRow(mtx.Row(9));
+  ASSERT_EQ(empty, S21Matrix<int>(mtx.Row(9)));
+}
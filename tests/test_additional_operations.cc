@@ -47,6 +47,21 @@ TEST(MatrixAdditionalOperations, MinorMatrix) {
   ASSERT_EQ(mtx.MinorMatrix(2, 2), res);
 }
 
+TEST(MatrixAdditionalOperations, MinorMatrixElements) {
+  S21Matrix<int> mtx(4, 4);
+  for (size_t r = 0; r < 4; ++r) {
+    for (size_t c = 0; c < 4; ++c) mtx(r, c) = r * 4 + c;
+  }
+  S21Matrix<int> minor = mtx.MinorMatrix(1, 2);
+  for (size_t r = 0; r < 3; ++r) {
+    for (size_t c = 0; c < 3; ++c) {
+      ASSERT_EQ(minor(r, c), mtx(r + (r >= 1), c + (c >= 2)));
+    }
+  }
+  ASSERT_THROW(mtx.MinorMatrix(4, 0), std::out_of_range);
+  ASSERT_THROW(mtx.MinorMatrix(0, 4), std::out_of_range);
+}
+
 TEST(MatrixAdditionalOperations, Minor) {
   size_t rows = 2, cols = 2;
   double res, value;
@@ -0,0 +1,140 @@
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <cmath>
+#include <type_traits>
+
+#include "s21_matrix_batch.h"
+
+namespace {
+
+// diagonally dominant, so every matrix is invertible
+S21Matrix<double> MakeMatrix(size_t rows, size_t cols, unsigned seed) {
+  S21Matrix<double> mtx(rows, cols);
+  for (size_t r = 0; r < rows; ++r) {
+    for (size_t c = 0; c < cols; ++c) {
+      seed = seed * 1103515245u + 12345u;
+      mtx(r, c) = static_cast<double>((seed >> 8) % 19) - 9.0;
+    }
+    if (r < cols) mtx(r, r) += 10.0 * cols;
+  }
+  return mtx;
+}
+
+template <typename Batch>
+Batch MakeBatch(size_t count, size_t rows, size_t cols, unsigned seed) {
+  Batch batch(count, rows, cols);
+  for (size_t i = 0; i < count; ++i) {
+    batch.Set(i, MakeMatrix(rows, cols, seed + i));
+  }
+  return batch;
+}
+
+}  // namespace
+
+template <typename Batch>
+class MatrixBatch : public ::testing::Test {};
+
+using Layouts =
+    ::testing::Types<S21MatrixBatch<double, s21::BatchLayout::kSoa>,
+                     S21MatrixBatch<double, s21::BatchLayout::kAos>>;
+TYPED_TEST_SUITE(MatrixBatch, Layouts);
+
+TYPED_TEST(MatrixBatch, GetSetAndIndex) {
+  TypeParam batch(5, 2, 3);
+  S21Matrix<double> mtx = MakeMatrix(2, 3, 7);
+  batch.Set(3, mtx);
+  ASSERT_EQ(batch.Get(3), mtx);
+  ASSERT_EQ(batch.Get(2), S21Matrix<double>(2, 3));
+  ASSERT_EQ(batch(3, 1, 2), mtx(1, 2));
+  ASSERT_EQ(batch.Data()[batch.Index(3, 1, 2)], mtx(1, 2));
+
+  ASSERT_THROW(batch(5, 0, 0), std::out_of_range);
+  ASSERT_THROW(batch(0, 2, 0), std::out_of_range);
+  ASSERT_THROW(batch.Get(5), std::out_of_range);
+  ASSERT_THROW(batch.Set(0, S21Matrix<double>(3, 2)), std::logic_error);
+
+  TypeParam copies(4, mtx);
+  for (size_t i = 0; i < 4; ++i) ASSERT_EQ(copies.Get(i), mtx);
+}
+
+TYPED_TEST(MatrixBatch, MulMatrixAndTransposeMatchSingleMatrices) {
+  // more matrices than one group of lanes, and a partial last group
+  size_t count = 150;
+  auto lhs = MakeBatch<TypeParam>(count, 3, 4, 1);
+  auto rhs = MakeBatch<TypeParam>(count, 4, 2, 1000);
+  TypeParam product = lhs * rhs;
+  TypeParam transposed = lhs.Transpose();
+  ASSERT_EQ(product.GetRows(), 3u);
+  ASSERT_EQ(product.GetCols(), 2u);
+  for (size_t i = 0; i < count; ++i) {
+    ASSERT_EQ(product.Get(i), lhs.Get(i) * rhs.Get(i));
+    ASSERT_EQ(transposed.Get(i), lhs.Get(i).Transpose());
+  }
+
+  ASSERT_THROW(lhs * lhs, std::logic_error);
+  ASSERT_THROW(lhs * TypeParam(count + 1, 4, 2), std::logic_error);
+}
+
+TYPED_TEST(MatrixBatch, DeterminantAndInverseMatchSingleMatrices) {
+  for (size_t n : {1u, 2u, 3u, 4u, 6u}) {
+    size_t count = 100;
+    auto batch = MakeBatch<TypeParam>(count, n, n, 7 * n);
+    auto det = batch.Determinant();
+    TypeParam inv = batch.InverseMatrix();
+    ASSERT_EQ(det.size(), count);
+    for (size_t i = 0; i < count; ++i) {
+      S21Matrix<double> mtx = batch.Get(i);
+      ASSERT_NEAR(det[i], mtx.Determinant(), 1e-9 * std::fabs(det[i]));
+      ASSERT_EQ(inv.Get(i), mtx.InverseMatrix());
+    }
+  }
+}
+
+TYPED_TEST(MatrixBatch, PivotingAndSingularMatrices) {
+  TypeParam batch(3, 3, 3);
+  // a zero leading element needs a row exchange
+  batch.Set(0, S21Matrix<double>(3, 3, 1.0));
+  batch(0, 0, 0) = 0.0, batch(0, 1, 1) = 2.0, batch(0, 2, 2) = 3.0;
+  // rows 0 and 2 are equal
+  batch.Set(1, MakeMatrix(3, 3, 5));
+  for (size_t c = 0; c < 3; ++c) batch(1, 2, c) = batch(1, 0, c);
+  batch.Set(2, MakeMatrix(3, 3, 9));
+
+  auto det = batch.Determinant();
+  ASSERT_NEAR(det[0], batch.Get(0).Determinant(), 1e-12);
+  ASSERT_EQ(det[1], 0.0);
+  ASSERT_NEAR(det[2], batch.Get(2).Determinant(), 1e-9);
+
+  try {
+    batch.InverseMatrix();
+    FAIL() << "a singular matrix was inverted";
+  } catch (const std::logic_error& e) {
+    ASSERT_STREQ(e.what(), "The determinant of matrix 1 is zero.");
+  }
+  ASSERT_THROW(TypeParam(2, 2, 3).Determinant(), std::logic_error);
+}
+
+TEST(MatrixBatchInt, FactorisationsRunInDouble) {
+  S21MatrixBatch<int> batch(2, 2, 2);
+  batch(0, 0, 0) = 4, batch(0, 0, 1) = 7;
+  batch(0, 1, 0) = 2, batch(0, 1, 1) = 6;
+  batch(1, 0, 0) = 1, batch(1, 1, 1) = 1;
+  auto det = batch.Determinant();
+  ASSERT_TRUE((std::is_same_v<decltype(det)::value_type, double>));
+  ASSERT_DOUBLE_EQ(det[0], 10.0);
+  ASSERT_DOUBLE_EQ(det[1], 1.0);
+  ASSERT_EQ(batch.InverseMatrix().Get(1), batch.Get(1));
+}
+
+TEST(MatrixBatchThreads, ResultsDoNotDependOnThreads) {
+  auto batch = MakeBatch<S21MatrixBatch<double>>(1000, 4, 4, 3);
+  auto serial_det = batch.Determinant();
+  auto serial_inv = batch.InverseMatrix();
+  s21::ScopedExecutionPolicy policy({4, 0});
+  auto det = batch.Determinant();
+  auto inv = batch.InverseMatrix();
+  ASSERT_TRUE(std::equal(det.begin(), det.end(), serial_det.begin()));
+  ASSERT_TRUE(std::equal(inv.Data(), inv.Data() + 1000 * 16,
+                         serial_inv.Data()));
+}
@@ -0,0 +1,185 @@
+#include <gtest/gtest.h>
+
+#include <cstdint>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <sstream>
+#include <string>
+
+#include "s21_matrix_binary.h"
+
+namespace {
+
+S21Matrix<double> MakeFilled(size_t rows, size_t cols) {
+  S21Matrix<double> mtx(rows, cols);
+  for (size_t r = 0; r < rows; ++r) {
+    for (size_t c = 0; c < cols; ++c) mtx(r, c) = r * 0.1 - c / 3.0;
+  }
+  return mtx;
+}
+
+// a file removed when the test ends
+class TempFile {
+ public:
+  explicit TempFile(const std::string& name)
+      : _path((std::filesystem::temp_directory_path() / name).string()) {}
+  ~TempFile() { std::filesystem::remove(_path); }
+  const std::string& Path() const { return _path; }
+
+ private:
+  std::string _path;
+};
+
+std::string Serialize(const S21Matrix<double>& mtx) {
+  std::stringstream ss;
+  s21::WriteBinary(ss, mtx);
+  return ss.str();
+}
+
+S21Matrix<double> Deserialize(const std::string& bytes) {
+  std::stringstream ss(bytes);
+  return s21::ReadBinary<double>(ss);
+}
+
+}  // namespace
+
+TEST(MatrixBinary, HeaderDescribesTheMatrix) {
+  std::string bytes = Serialize(MakeFilled(3, 5));
+  ASSERT_EQ(bytes.size(), sizeof(s21::BinaryHeader) + 15 * sizeof(double));
+  s21::BinaryHeader header;
+  std::memcpy(&header, bytes.data(), sizeof(header));
+  EXPECT_EQ(std::string(header.magic), "S21MTRX");
+  EXPECT_EQ(header.kind, 'f');
+  EXPECT_EQ(header.element_size, 8u);
+  EXPECT_EQ(header.rows, 3u);
+  EXPECT_EQ(header.cols, 5u);
+  EXPECT_EQ(header.stride, 5u);
+  EXPECT_EQ(header.data_offset % (1u << header.alignment_log2), 0u);
+}
+
+TEST(MatrixBinary, RoundTripIsExact) {
+  for (auto [rows, cols] : {std::pair<size_t, size_t>{0, 0},
+                            {1, 1},
+                            {7, 3},
+                            {33, 45},
+                            {4, 512}}) {
+    auto mtx = MakeFilled(rows, cols);
+    auto loaded = Deserialize(Serialize(mtx));
+    ASSERT_EQ(loaded.GetRows(), rows);
+    ASSERT_EQ(loaded.GetCols(), cols);
+    for (size_t r = 0; r < rows; ++r) {
+      for (size_t c = 0; c < cols; ++c) ASSERT_EQ(loaded(r, c), mtx(r, c));
+    }
+  }
+}
+
+TEST(MatrixBinary, ViewsAreWrittenDensely) {
+  auto mtx = MakeFilled(20, 30);
+  std::stringstream ss;
+  s21::WriteBinary(ss, mtx.Block(2, 3, 4, 5));
+  auto loaded = s21::ReadBinary<double>(ss);
+  EXPECT_TRUE(loaded == mtx.Block(2, 3, 4, 5));
+}
+
+TEST(MatrixBinary, IntegerTypes) {
+  S21Matrix<std::int16_t> mtx(3, 3);
+  mtx(0, 0) = -32768;
+  mtx(2, 1) = 32767;
+  std::stringstream ss;
+  s21::WriteBinary(ss, mtx);
+  auto loaded = s21::ReadBinary<std::int16_t>(ss);
+  EXPECT_TRUE(loaded == mtx);
+}
+
+TEST(MatrixBinary, RejectsMismatchesAndCorruption) {
+  std::string bytes = Serialize(MakeFilled(4, 4));
+  std::stringstream as_float(bytes);
+  EXPECT_THROW(s21::ReadBinary<float>(as_float), std::runtime_error);
+  std::stringstream as_int(bytes);
+  EXPECT_THROW(s21::ReadBinary<std::int64_t>(as_int), std::runtime_error);
+  EXPECT_THROW(Deserialize(bytes.substr(0, bytes.size() - 1)),
+               std::runtime_error);
+  EXPECT_THROW(Deserialize(bytes.substr(0, 10)), std::runtime_error);
+  std::string bad_magic = bytes;
+  bad_magic[0] = 'X';
+  EXPECT_THROW(Deserialize(bad_magic), std::runtime_error);
+}
+
+TEST(MatrixBinary, RejectsLayoutsPastTheFile) {
+  std::string bytes = Serialize(MakeFilled(4, 4));
+  s21::BinaryHeader header;
+  std::memcpy(&header, bytes.data(), sizeof(header));
+  // an offset whose extent wraps around to 64 bytes, inside the file
+  header.data_offset = UINT64_MAX - 63;
+  std::string wrapped = bytes;
+  std::memcpy(wrapped.data(), &header, sizeof(header));
+  EXPECT_THROW(Deserialize(wrapped), std::runtime_error);
+  // a valid offset, but far past the end of the stream
+  header.data_offset = std::uint64_t{1} << 40;
+  std::string distant = bytes;
+  std::memcpy(distant.data(), &header, sizeof(header));
+  EXPECT_THROW(Deserialize(distant), std::runtime_error);
+  // rows that would not fit in memory are refused before any allocation
+  header.data_offset = sizeof(header);
+  header.rows = header.stride = header.cols = std::uint64_t{1} << 30;
+  std::string huge = bytes;
+  std::memcpy(huge.data(), &header, sizeof(header));
+  EXPECT_THROW(Deserialize(huge), std::runtime_error);
+
+  TempFile file("s21_matrix_wrapped.bin");
+  std::ofstream(file.Path(), std::ios::binary) << wrapped;
+  EXPECT_THROW(s21::LoadBinary<double>(file.Path()), std::runtime_error);
+  EXPECT_THROW(s21::MappedMatrix<double>{file.Path()}, std::runtime_error);
+}
+
+TEST(MatrixBinary, ReadsTheOtherByteOrder) {
+  auto mtx = MakeFilled(6, 9);
+  std::string bytes = Serialize(mtx);
+  s21::BinaryHeader header;
+  std::memcpy(&header, bytes.data(), sizeof(header));
+  header.endianness = header.endianness == s21::kLittleEndian
+                          ? s21::kBigEndian
+                          : s21::kLittleEndian;
+  s21::detail::ByteSwap(header.version);
+  s21::detail::ByteSwap(header.rows);
+  s21::detail::ByteSwap(header.cols);
+  s21::detail::ByteSwap(header.stride);
+  s21::detail::ByteSwap(header.data_offset);
+  std::memcpy(bytes.data(), &header, sizeof(header));
+  auto* data = reinterpret_cast<double*>(bytes.data() + sizeof(header));
+  s21::detail::ByteSwap(data, 6 * 9);
+  EXPECT_TRUE(Deserialize(bytes) == mtx);
+
+  TempFile file("s21_matrix_foreign.bin");
+  std::ofstream(file.Path(), std::ios::binary) << bytes;
+  EXPECT_THROW(s21::MappedMatrix<double>{file.Path()}, std::runtime_error);
+}
+
+TEST(MatrixBinary, SaveAndLoadFiles) {
+  TempFile file("s21_matrix_save.bin");
+  auto mtx = MakeFilled(40, 50);
+  s21::SaveBinary(file.Path(), mtx);
+  EXPECT_TRUE(s21::LoadBinary<double>(file.Path()) == mtx);
+  EXPECT_THROW(s21::LoadBinary<double>(file.Path() + ".missing"),
+               std::runtime_error);
+}
+
+TEST(MatrixBinary, MappedFilesAreViewedInPlace) {
+  TempFile file("s21_matrix_mapped.bin");
+  auto mtx = MakeFilled(100, 70);
+  s21::SaveBinary(file.Path(), mtx);
+  s21::MappedMatrix<double> mapped(file.Path());
+  ASSERT_EQ(mapped.GetRows(), 100u);
+  ASSERT_EQ(mapped.GetCols(), 70u);
+  EXPECT_EQ(reinterpret_cast<std::uintptr_t>(mapped.View().Data()) % 64, 0u);
+  EXPECT_TRUE(mtx == mapped.View());
+  EXPECT_TRUE(mapped.ToMatrix() * mtx.Transpose() == mtx * mtx.Transpose());
+
+  s21::MappedMatrix<double> moved(std::move(mapped));
+  EXPECT_EQ(mapped.GetRows(), 0u);
+  EXPECT_EQ(moved.View()(99, 69), mtx(99, 69));
+  EXPECT_THROW(s21::MappedMatrix<float>{file.Path()}, std::runtime_error);
+  EXPECT_THROW(s21::MappedMatrix<double>{file.Path() + ".missing"},
+               std::system_error);
+}
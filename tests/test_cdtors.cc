@@ -1,5 +1,8 @@
 #include <gtest/gtest.h>
 
+#include <cstdint>
+#include <new>
+
 #include "s21_matrix_oop.h"
 
 TEST(MatrixConstructors, DefaultConstructor) {
@@ -32,6 +35,15 @@ TEST(MatrixConstructors, ParametrisedConstructor) {
 
   ASSERT_NO_THROW(S21Matrix<int>(0, 1));
   ASSERT_NO_THROW(S21Matrix<int>(1, 0));
+
+  // rows * stride would wrap around to 32 elements
+  size_t huge = (size_t{1} << 59) + 1;
+  ASSERT_THROW(S21Matrix<double>(huge, 32), std::bad_array_new_length);
+  ASSERT_THROW(S21Matrix<double>(1, SIZE_MAX - 3), std::bad_array_new_length);
+  S21Matrix<double> small(1, 32);
+  ASSERT_THROW(small.SetRows(huge), std::bad_array_new_length);
+  ASSERT_THROW(small.Reserve(huge), std::bad_array_new_length);
+  ASSERT_EQ(small.GetRows(), 1u);
 }
 
 TEST(MatrixConstructors, CopyConstructor) {
@@ -0,0 +1,111 @@
+#include <gtest/gtest.h>
+
+#include "s21_matrix_decompositions.h"
+
+namespace {
+
+S21Matrix<double> MakeNoise(size_t rows, size_t cols, unsigned seed) {
+  S21Matrix<double> mtx(rows, cols);
+  for (size_t r = 0; r < rows; ++r) {
+    for (size_t c = 0; c < cols; ++c) {
+      seed = seed * 1103515245u + 12345u;
+      mtx(r, c) = static_cast<double>((seed >> 8) % 1000) / 100.0 - 5.0;
+    }
+  }
+  return mtx;
+}
+
+// B^T * B + n * I is symmetric positive definite
+S21Matrix<double> MakeSpd(size_t n, unsigned seed) {
+  S21Matrix<double> base = MakeNoise(n, n, seed);
+  S21Matrix<double> spd = base.Transpose() * base;
+  for (size_t i = 0; i < n; ++i) spd(i, i) += static_cast<double>(n);
+  return spd;
+}
+
+void ExpectNear(const S21Matrix<double>& lhs, const S21Matrix<double>& rhs,
+                double tolerance) {
+  ASSERT_TRUE(lhs.IsEqualSize(rhs));
+  for (size_t r = 0; r < lhs.GetRows(); ++r) {
+    for (size_t c = 0; c < lhs.GetCols(); ++c) {
+      ASSERT_NEAR(lhs(r, c), rhs(r, c), tolerance) << r << ", " << c;
+    }
+  }
+}
+
+}  // namespace
+
+TEST(MatrixDecompositions, LUSolvesManyRightHandSides) {
+  S21Matrix<double> mtx = MakeSpd(12, 1);
+  mtx(0, 0) = 0;  // not SPD any more, LU has to pivot
+  S21Matrix<double> x = MakeNoise(12, 70, 2);
+  s21::LU<double> lu(mtx);
+  ExpectNear(lu.Solve(mtx * x), x, 1e-9);
+  ASSERT_THROW(lu.Solve(S21Matrix<double>(11, 1)), std::logic_error);
+  ASSERT_THROW(s21::LU<double>(S21Matrix<double>(2, 2)).Solve(
+                   S21Matrix<double>(2, 1)),
+               std::logic_error);
+}
+
+TEST(MatrixDecompositions, CholeskyFactorsAndSolves) {
+  S21Matrix<double> spd = MakeSpd(9, 3);
+  s21::Cholesky<double> chol(spd);
+  S21Matrix<double> lower = chol.GetLower();
+  ExpectNear(lower * lower.Transpose(), spd, 1e-10);
+  ASSERT_EQ(lower(0, 5), 0);
+  ASSERT_NEAR(chol.Determinant() / spd.Determinant(), 1, 1e-10);
+
+  S21Matrix<double> x = MakeNoise(9, 33, 4);
+  ExpectNear(chol.Solve(spd * x), x, 1e-9);
+}
+
+TEST(MatrixDecompositions, CholeskyRejectsIndefiniteMatrices) {
+  S21Matrix<double> mtx(2, 2);
+  mtx(0, 0) = 1, mtx(0, 1) = 2, mtx(1, 0) = 2, mtx(1, 1) = 1;
+  ASSERT_THROW(s21::Cholesky<double>{mtx}, std::logic_error);
+  ASSERT_THROW(s21::Cholesky<double>(S21Matrix<double>(2, 3)),
+               std::logic_error);
+}
+
+TEST(MatrixDecompositions, QRFactorsAndSolves) {
+  S21Matrix<double> mtx = MakeNoise(8, 8, 5);
+  s21::QR<double> qr(mtx);
+  S21Matrix<double> q = qr.GetQ();
+  S21Matrix<double> r = qr.GetR();
+  ExpectNear(q * r, mtx, 1e-12);
+  S21Matrix<double> identity(8, 8);
+  for (size_t i = 0; i < 8; ++i) identity(i, i) = 1;
+  ExpectNear(q.Transpose() * q, identity, 1e-12);
+  ASSERT_EQ(r(7, 0), 0);
+
+  S21Matrix<double> x = MakeNoise(8, 20, 6);
+  ExpectNear(qr.Solve(mtx * x), x, 1e-9);
+}
+
+TEST(MatrixDecompositions, QRLeastSquares) {
+  // fit y = 2 + 3 t through points that lie on the line exactly,
+  // then check the normal equations for noisy points
+  S21Matrix<double> design(5, 2);
+  S21Matrix<double> y(5, 1);
+  for (size_t i = 0; i < 5; ++i) {
+    design(i, 0) = 1, design(i, 1) = static_cast<double>(i);
+    y(i, 0) = 2 + 3 * static_cast<double>(i);
+  }
+  s21::QR<double> qr(design);
+  S21Matrix<double> coef = qr.Solve(y);
+  ASSERT_NEAR(coef(0, 0), 2, 1e-12);
+  ASSERT_NEAR(coef(1, 0), 3, 1e-12);
+
+  y(1, 0) += 0.5, y(3, 0) -= 0.25;
+  coef = qr.Solve(y);
+  S21Matrix<double> residual = design * coef - y;
+  for (size_t c = 0; c < 2; ++c) {
+    double dot = 0;
+    for (size_t i = 0; i < 5; ++i) dot += design(i, c) * residual(i, 0);
+    ASSERT_NEAR(dot, 0, 1e-12);
+  }
+
+  ASSERT_THROW(s21::QR<double>(S21Matrix<double>(2, 3)), std::logic_error);
+  ASSERT_THROW(s21::QR<double>(S21Matrix<double>(3, 2)).Solve(y),
+               std::logic_error);
+}
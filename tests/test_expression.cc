@@ -0,0 +1,103 @@
+#include <gtest/gtest.h>
+
+#include <sstream>
+#include <type_traits>
+
+#include "s21_matrix_oop.h"
+
+namespace {
+
+S21Matrix<double> MakeFilled(size_t rows, size_t cols, double start) {
+  S21Matrix<double> mtx(rows, cols);
+  for (size_t r = 0; r < rows; ++r) {
+    for (size_t c = 0; c < cols; ++c) {
+      mtx(r, c) = start + static_cast<double>(r * cols + c);
+    }
+  }
+  return mtx;
+}
+
+}  // namespace
+
+TEST(MatrixExpression, OperatorsBuildLazyNodes) {
+  S21Matrix<double> a(2, 2), b(2, 2);
+  auto sum = a + b;
+  auto scaled = 2 * (a - b);
+  ASSERT_FALSE((std::is_same_v<decltype(sum), S21Matrix<double>>));
+  ASSERT_FALSE((std::is_same_v<decltype(scaled), S21Matrix<double>>));
+  ASSERT_EQ(sum.GetRows(), 2u);
+  ASSERT_EQ(scaled.GetCols(), 2u);
+}
+
+TEST(MatrixExpression, ChainedArithmeticMatchesStepByStep) {
+  S21Matrix<double> a = MakeFilled(3, 4, 1);
+  S21Matrix<double> b = MakeFilled(3, 4, -5);
+  S21Matrix<double> c = MakeFilled(3, 4, 0.5);
+
+  S21Matrix<double> ans = a;
+  ans.SumMatrix(b);
+  S21Matrix<double> scaled = c;
+  scaled.MulNumber(2.0);
+  ans.SubMatrix(scaled);
+
+  S21Matrix<double> res = a + b - c * 2.0;
+  ASSERT_EQ(res, ans);
+  ASSERT_EQ(a + b - 2.0 * c, ans);
+  ASSERT_EQ((a - b) * 0.5 + (a + b) * 0.5, a);
+}
+
+TEST(MatrixExpression, IntegerNodesRoundLikeTemporaries) {
+  S21Matrix<unsigned char> a(1, 2, 200), b(1, 2, 100);
+  // (a + b) wraps to 44 before the subtraction, as with a temporary
+  S21Matrix<unsigned char> res = (a + b) * 0.5L - b;
+  S21Matrix<unsigned char> tmp = a;
+  tmp += b;
+  tmp *= 0.5L;
+  tmp -= b;
+  ASSERT_EQ(res, tmp);
+}
+
+TEST(MatrixExpression, AssignmentIsEvaluatedInPlace) {
+  S21Matrix<double> a = MakeFilled(4, 4, 0);
+  S21Matrix<double> b = MakeFilled(4, 4, 10);
+  S21Matrix<double> ans = MakeFilled(4, 4, 0);
+  ans += b;
+  ans *= 3;
+
+  const double* storage = &a(0, 0);
+  a = (a + b) * 3;
+  ASSERT_EQ(&a(0, 0), storage);
+  ASSERT_EQ(a, ans);
+
+  a -= b + b;
+  ASSERT_EQ(&a(0, 0), storage);
+  ans -= b;
+  ans -= b;
+  ASSERT_EQ(a, ans);
+
+  S21Matrix<double> other(1, 1);
+  other = a - b;
+  ASSERT_EQ(other.GetDim(), std::make_tuple(4, 4));
+}
+
+TEST(MatrixExpression, SizeMismatchThrowsWhenBuilt) {
+  S21Matrix<double> a(2, 2), b(2, 3);
+  ASSERT_THROW(a + b, std::logic_error);
+  ASSERT_THROW(a - b * 2, std::logic_error);
+  ASSERT_THROW((a + a) - b, std::logic_error);
+}
+
+TEST(MatrixExpression, ExpressionsAsMatrixOperands) {
+  S21Matrix<double> a = MakeFilled(2, 3, 1);
+  S21Matrix<double> b = MakeFilled(3, 2, 1);
+  S21Matrix<double> product = (a + a) * b;
+  ASSERT_EQ(product, a * b * 2);
+  ASSERT_EQ(a * (b - b), S21Matrix<double>(2, 2));
+  ASSERT_TRUE(a == a * 1);
+  ASSERT_FALSE(a * 2 == a);
+
+  std::stringstream expr, mtx;
+  expr << a + a;
+  mtx << S21Matrix<double>(a * 2);
+  ASSERT_EQ(expr.str(), mtx.str());
+}
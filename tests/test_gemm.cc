@@ -0,0 +1,64 @@
+#include <gtest/gtest.h>
+
+#include "s21_matrix_oop.h"
+
+namespace {
+
+template <typename T>
+S21Matrix<T> MakeSequence(size_t rows, size_t cols, int modulo) {
+  S21Matrix<T> mtx(rows, cols);
+  for (size_t r = 0; r < rows; ++r) {
+    for (size_t c = 0; c < cols; ++c) {
+      mtx(r, c) = static_cast<T>(static_cast<int>((r * 7 + c * 3) % modulo) -
+                                 modulo / 2);
+    }
+  }
+  return mtx;
+}
+
+template <typename T>
+S21Matrix<T> NaiveProduct(const S21Matrix<T>& lhs, const S21Matrix<T>& rhs) {
+  S21Matrix<T> res(lhs.GetRows(), rhs.GetCols());
+  for (size_t r = 0; r < lhs.GetRows(); ++r) {
+    for (size_t m = 0; m < lhs.GetCols(); ++m) {
+      for (size_t c = 0; c < rhs.GetCols(); ++c) {
+        res(r, c) += lhs(r, m) * rhs(m, c);
+      }
+    }
+  }
+  return res;
+}
+
+}  // namespace
+
+TEST(MatrixGemm, MatchesNaiveLoopOnOddShapes) {
+  // shapes straddle the micro-tile and the KC/MC cache blocks
+  const size_t shapes[][3] = {{1, 1, 1},    {3, 5, 7},     {33, 17, 65},
+                              {129, 3, 31}, {5, 257, 130}, {131, 300, 70}};
+  for (const auto& shape : shapes) {
+    S21Matrix<long> lhs = MakeSequence<long>(shape[0], shape[1], 11);
+    S21Matrix<long> rhs = MakeSequence<long>(shape[1], shape[2], 13);
+    ASSERT_EQ(lhs * rhs, NaiveProduct(lhs, rhs));
+  }
+}
+
+TEST(MatrixGemm, FloatingPointAgreesWithNaiveLoop) {
+  S21Matrix<double> lhs = MakeSequence<double>(70, 300, 9);
+  S21Matrix<double> rhs = MakeSequence<double>(300, 45, 5);
+  S21Matrix<double> res = lhs * rhs;
+  S21Matrix<double> ans = NaiveProduct(lhs, rhs);
+  // small integers are exact in double whatever the summation order
+  ASSERT_EQ(res, ans);
+
+  S21Matrix<float> flhs = MakeSequence<float>(40, 130, 7);
+  S21Matrix<float> frhs = MakeSequence<float>(130, 40, 3);
+  S21Matrix<float> fres = flhs;
+  fres *= frhs;
+  ASSERT_EQ(fres, NaiveProduct(flhs, frhs));
+}
+
+TEST(MatrixGemm, DegenerateInnerDimension) {
+  S21Matrix<double> lhs(3, 0);
+  S21Matrix<double> rhs(0, 4);
+  ASSERT_EQ(lhs * rhs, S21Matrix<double>(3, 4));
+}
@@ -0,0 +1,115 @@
+#include <gtest/gtest.h>
+
+#include "s21_matrix_decompositions.h"
+
+namespace {
+
+S21Matrix<double> MakeWellConditioned(size_t n, unsigned seed) {
+  S21Matrix<double> mtx(n, n);
+  for (size_t r = 0; r < n; ++r) {
+    for (size_t c = 0; c < n; ++c) {
+      seed = seed * 1103515245u + 12345u;
+      mtx(r, c) = static_cast<double>((seed >> 8) % 1000) / 100.0 - 5.0;
+    }
+    mtx(r, r) += static_cast<double>(n) * 5;
+  }
+  return mtx;
+}
+
+void ExpectNear(const S21Matrix<double>& lhs, const S21Matrix<double>& rhs,
+                double tolerance) {
+  ASSERT_TRUE(lhs.IsEqualSize(rhs));
+  for (size_t r = 0; r < lhs.GetRows(); ++r) {
+    for (size_t c = 0; c < lhs.GetCols(); ++c) {
+      ASSERT_NEAR(lhs(r, c), rhs(r, c), tolerance) << r << ", " << c;
+    }
+  }
+}
+
+S21Matrix<double> Identity(size_t n) {
+  S21Matrix<double> mtx(n, n);
+  for (size_t i = 0; i < n; ++i) mtx(i, i) = 1;
+  return mtx;
+}
+
+}  // namespace
+
+TEST(MatrixLU, FactorsReproduceThePermutedMatrix) {
+  S21Matrix<double> mtx = MakeWellConditioned(6, 1);
+  mtx(0, 0) = 0;  // forces a row exchange
+  s21::LU<double> lu(mtx);
+  ASSERT_FALSE(lu.IsSingular());
+
+  S21Matrix<double> permuted(6, 6);
+  for (size_t r = 0; r < 6; ++r) {
+    for (size_t c = 0; c < 6; ++c) {
+      permuted(r, c) = mtx(lu.GetPermutation()[r], c);
+    }
+  }
+  ExpectNear(lu.GetLower() * lu.GetUpper(), permuted, 1e-12);
+}
+
+TEST(MatrixLU, NonSquareIsRejected) {
+  ASSERT_THROW(s21::LU<double>(S21Matrix<double>(2, 3)), std::logic_error);
+}
+
+TEST(MatrixLU, DeterminantAndInverse) {
+  S21Matrix<double> mtx(4, 4);
+  mtx(0, 0) = 2, mtx(0, 1) = 1, mtx(0, 2) = 0, mtx(0, 3) = 0;
+  mtx(1, 0) = 1, mtx(1, 1) = 3, mtx(1, 2) = 1, mtx(1, 3) = 0;
+  mtx(2, 0) = 0, mtx(2, 1) = 1, mtx(2, 2) = 4, mtx(2, 3) = 1;
+  mtx(3, 0) = 0, mtx(3, 1) = 0, mtx(3, 2) = 1, mtx(3, 3) = 5;
+  // tridiagonal: det = 5 * det3 - det2 = 5 * 18 - 5
+  s21::LU<double> lu(mtx);
+  ASSERT_NEAR(lu.Determinant(), 85, 1e-12);
+  ASSERT_NEAR(mtx.Determinant(), 85, 1e-12);
+  ExpectNear(lu.Inverse() * mtx, Identity(4), 1e-14);
+  ExpectNear(mtx.InverseMatrix(), lu.Inverse(), 0);
+}
+
+TEST(MatrixLU, InverseOfLargerMatrices) {
+  for (size_t n : {4, 9, 40}) {
+    S21Matrix<double> mtx = MakeWellConditioned(n, n);
+    ExpectNear(mtx * mtx.InverseMatrix(), Identity(n), 1e-12);
+  }
+}
+
+TEST(MatrixLU, ComplementsMatchPerMinorDefinition) {
+  S21Matrix<double> mtx = MakeWellConditioned(6, 7);
+  S21Matrix<double> ans(6, 6);
+  for (size_t r = 0; r < 6; ++r) {
+    for (size_t c = 0; c < 6; ++c) {
+      ans(r, c) = ((r + c) % 2 ? -1 : 1) * mtx.Minor(r, c);
+    }
+  }
+  ExpectNear(mtx.CalcComplements(), ans, 1e-6 * std::fabs(mtx.Determinant()));
+}
+
+TEST(MatrixLU, SingularMatrices) {
+  S21Matrix<double> mtx(5, 5, 1.0);
+  for (size_t i = 0; i < 5; ++i) mtx(i, i) = 2;
+  mtx(4, 0) = mtx(3, 0), mtx(4, 1) = mtx(3, 1), mtx(4, 2) = mtx(3, 2);
+  mtx(4, 3) = mtx(3, 3), mtx(4, 4) = mtx(3, 4);  // duplicated row
+
+  s21::LU<double> lu(mtx);
+  ASSERT_TRUE(lu.IsSingular());
+  ASSERT_EQ(lu.Determinant(), 0);
+  ASSERT_THROW(lu.Inverse(), std::logic_error);
+  ASSERT_EQ(mtx.Determinant(), 0);
+  ASSERT_THROW(mtx.InverseMatrix(), std::logic_error);
+
+  // complements of a singular matrix fall back to the minors
+  S21Matrix<double> comps = mtx.CalcComplements();
+  ASSERT_NEAR(comps(0, 0), mtx.Minor(0, 0), 1e-12);
+  ASSERT_NEAR(comps(4, 3), -mtx.Minor(4, 3), 1e-12);
+}
+
+TEST(MatrixLU, IntegerMatricesAreFactoredInDouble) {
+  S21Matrix<int> mtx(4, 4);
+  mtx(0, 0) = 2, mtx(0, 1) = 1;
+  mtx(1, 0) = 1, mtx(1, 1) = 3, mtx(1, 2) = 1;
+  mtx(2, 1) = 1, mtx(2, 2) = 4, mtx(2, 3) = 1;
+  mtx(3, 2) = 1, mtx(3, 3) = 5;
+  ASSERT_NEAR(mtx.Determinant(), 85, 1e-12);
+  ASSERT_NEAR(s21::LU<int>(mtx).Determinant(), 85, 1e-12);
+}
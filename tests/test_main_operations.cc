@@ -137,6 +137,48 @@ TEST(MatrixMainOperations, Transpose) {
   ans(0, 0) = 1, ans(0, 1) = 3, ans(1, 0) = -2, ans(1, 1) = -4;
   trans = mtx.Transpose();
   ASSERT_EQ(trans, ans);
+
+  mtx = S21Matrix<double>(2, 3);
+  mtx(0, 0) = 1, mtx(0, 1) = 2, mtx(0, 2) = 3;
+  mtx(1, 0) = 4, mtx(1, 1) = 5, mtx(1, 2) = 6;
+  trans = mtx.Transpose();
+  ASSERT_EQ(trans.GetRows(), 3u);
+  ASSERT_EQ(trans.GetCols(), 2u);
+  ASSERT_EQ(trans(2, 0), 3);
+  ASSERT_EQ(trans(0, 1), 4);
+  ASSERT_EQ(trans.Transpose(), mtx);
+
+  // sizes that are not multiples of the tile, both orientations
+  for (auto [r, c] : {std::pair{1, 300}, std::pair{300, 1}, std::pair{77, 130},
+                      std::pair{130, 77}}) {
+    mtx = S21Matrix<double>(r, c);
+    for (int i = 0; i < r; ++i) {
+      for (int j = 0; j < c; ++j) mtx(i, j) = i * 1000 + j;
+    }
+    trans = mtx.Transpose();
+    ASSERT_EQ(trans.GetRows(), static_cast<size_t>(c));
+    for (int i = 0; i < r; ++i) {
+      for (int j = 0; j < c; ++j) ASSERT_EQ(trans(j, i), i * 1000 + j);
+    }
+  }
+}
+
+TEST(MatrixMainOperations, TransposeInPlace) {
+  S21Matrix<double> empty;
+  empty.TransposeInPlace();
+  ASSERT_EQ(empty, S21Matrix<double>());
+
+  ASSERT_THROW(S21Matrix<double>(2, 3).TransposeInPlace(), std::logic_error);
+
+  for (int n : {1, 2, 31, 33, 100}) {
+    S21Matrix<double> mtx(n, n);
+    for (int i = 0; i < n; ++i) {
+      for (int j = 0; j < n; ++j) mtx(i, j) = i * 1000 + j;
+    }
+    S21Matrix<double> expected = mtx.Transpose();
+    mtx.TransposeInPlace();
+    ASSERT_EQ(mtx, expected);
+  }
 }
 
 TEST(MatrixMainOperations, CalcComplements) {
@@ -0,0 +1,327 @@
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <cstdint>
+#include <mutex>
+#include <set>
+#include <thread>
+
+#include "s21_matrix_oop.h"
+
+namespace {
+
+// forwards to new/delete and keeps count
+class CountingResource : public std::pmr::memory_resource {
+ public:
+  size_t allocations = 0;
+  size_t deallocations = 0;
+  size_t bytes_in_use = 0;
+
+ protected:
+  void* do_allocate(size_t bytes, size_t alignment) override {
+    ++allocations;
+    bytes_in_use += bytes;
+    return std::pmr::new_delete_resource()->allocate(bytes, alignment);
+  }
+
+  void do_deallocate(void* ptr, size_t bytes, size_t alignment) override {
+    ++deallocations;
+    bytes_in_use -= bytes;
+    std::pmr::new_delete_resource()->deallocate(ptr, bytes, alignment);
+  }
+
+  bool do_is_equal(
+      const std::pmr::memory_resource& other) const noexcept override {
+    return this == &other;
+  }
+};
+
+// forwards to new/delete and records the threads that allocate
+class ThreadRecordingResource : public std::pmr::memory_resource {
+ public:
+  std::set<std::thread::id> threads;
+
+ protected:
+  void* do_allocate(size_t bytes, size_t alignment) override {
+    std::lock_guard<std::mutex> lock(_mutex);
+    threads.insert(std::this_thread::get_id());
+    return std::pmr::new_delete_resource()->allocate(bytes, alignment);
+  }
+
+  void do_deallocate(void* ptr, size_t bytes, size_t alignment) override {
+    std::pmr::new_delete_resource()->deallocate(ptr, bytes, alignment);
+  }
+
+  bool do_is_equal(
+      const std::pmr::memory_resource& other) const noexcept override {
+    return this == &other;
+  }
+
+ private:
+  std::mutex _mutex;
+};
+
+S21Matrix<double> MakeInvertible(size_t n, std::pmr::memory_resource* res) {
+  S21Matrix<double> mtx(n, n, res);
+  for (size_t r = 0; r < n; ++r) {
+    for (size_t c = 0; c < n; ++c) mtx(r, c) = (r == c) ? n : (r + 2 * c) % 3;
+  }
+  return mtx;
+}
+
+}  // namespace
+
+TEST(MatrixMemory, DefaultResource) {
+  ASSERT_EQ(S21Matrix<double>().GetResource(),
+            std::pmr::get_default_resource());
+  ASSERT_EQ(S21Matrix<double>(2, 2).GetResource(),
+            std::pmr::get_default_resource());
+  // a literal 0 is still the fill value, not a null resource
+  S21Matrix<double> zeros(2, 2, 0);
+  ASSERT_EQ(zeros(1, 1), 0);
+}
+
+TEST(MatrixMemory, ResultsInheritTheResource) {
+  CountingResource counting;
+  {
+    S21Matrix<double> lhs = MakeInvertible(5, &counting);
+    S21Matrix<double> rhs = MakeInvertible(5, &counting);
+    ASSERT_EQ(lhs.GetResource(), &counting);
+    ASSERT_EQ(lhs.GetAllocator().resource(), &counting);
+
+    std::vector<S21Matrix<double>> results;
+    results.push_back(lhs + rhs);
+    results.push_back(lhs - rhs * 2.0);
+    results.push_back(3.0 * lhs);
+    results.push_back(lhs * rhs);
+    results.push_back(lhs.Transpose());
+    results.push_back(lhs.CalcComplements());
+    results.push_back(lhs.InverseMatrix());
+    results.push_back(lhs.MinorMatrix(0, 0));
+    results.push_back(S21Matrix<double>(lhs));
+    S21Matrix<double> resized = lhs;
+    resized.SetDim(7, 3);
+    results.push_back(std::move(resized));
+    for (const auto& result : results) {
+      ASSERT_EQ(result.GetResource(), &counting);
+    }
+    // the copy that is resized within its capacity allocates only once
+    ASSERT_GE(counting.allocations, 1 + results.size());
+  }
+  ASSERT_EQ(counting.allocations, counting.deallocations);
+  ASSERT_EQ(counting.bytes_in_use, 0u);
+}
+
+TEST(MatrixMemory, WorkerThreadsDoNotAllocateFromTheResource) {
+  // a singular matrix too large for inline minors takes the minors path,
+  // whose cells are spread across the threads
+  ThreadRecordingResource recording;
+  S21Matrix<double> mtx(14, 14, &recording);
+  for (size_t r = 0; r < 14; ++r) {
+    for (size_t c = 0; c < 14; ++c) mtx(r, c) = (r * 3 + c) % 5;
+  }
+  for (size_t c = 0; c < 14; ++c) mtx(13, c) = mtx(0, c);
+  recording.threads.clear();
+  s21::ScopedExecutionPolicy policy({4, 0});
+  S21Matrix<double> complements = mtx.CalcComplements();
+  ASSERT_EQ(complements.GetResource(), &recording);
+  ASSERT_EQ(recording.threads,
+            std::set<std::thread::id>{std::this_thread::get_id()});
+}
+
+TEST(MatrixMemory, AssignmentKeepsOrSwapsTheResource) {
+  CountingResource first, second;
+  S21Matrix<double> lhs(6, 6, &first);
+  S21Matrix<double> rhs(5, 5, 1.0, &second);
+
+  lhs = rhs;  // copied into lhs's own resource
+  ASSERT_EQ(lhs.GetResource(), &first);
+  ASSERT_EQ(lhs, rhs);
+  ASSERT_EQ(first.bytes_in_use, 25 * sizeof(double));
+
+  lhs = rhs + rhs;  // new shape, still evaluated into lhs's resource
+  ASSERT_EQ(lhs.GetResource(), &first);
+
+  S21Matrix<double> moved(&first);
+  moved = std::move(rhs);  // the buffer brings its resource along
+  ASSERT_EQ(moved.GetResource(), &second);
+  S21Matrix<double> constructed(std::move(moved));
+  ASSERT_EQ(constructed.GetResource(), &second);
+
+  S21Matrix<double> placed(constructed, &first);
+  ASSERT_EQ(placed.GetResource(), &first);
+  ASSERT_EQ(placed, constructed);
+}
+
+TEST(MatrixMemory, PoolReusesFreedBlocks) {
+  CountingResource upstream;
+  s21::PoolResource pool(&upstream);
+  ASSERT_EQ(pool.GetUpstream(), &upstream);
+
+  const double* first = nullptr;
+  {
+    S21Matrix<double> mtx(8, 8, 1.0, &pool);
+    first = &mtx(0, 0);
+  }
+  for (int i = 0; i < 100; ++i) {
+    S21Matrix<double> mtx(8, 8, &pool);
+    ASSERT_EQ(&mtx(0, 0), first);
+    ASSERT_EQ(mtx(7, 7), 0);  // storage is zeroed on every allocation
+  }
+  ASSERT_EQ(upstream.allocations, 1u);
+
+  // beyond the largest class the pool is bypassed
+  {
+    S21Matrix<double> big(64, 64, &pool);
+    ASSERT_EQ(upstream.allocations, 2u);
+  }
+  ASSERT_EQ(upstream.deallocations, 1u);
+
+  {
+    S21Matrix<long double> aligned(5, 5, &pool);
+    ASSERT_EQ(reinterpret_cast<std::uintptr_t>(&aligned(0, 0)) %
+                  alignof(long double),
+              0u);
+  }
+
+  pool.Release();
+  ASSERT_EQ(upstream.bytes_in_use, 0u);
+}
+
+TEST(MatrixMemory, ArenaResetsInBulk) {
+  CountingResource upstream;
+  s21::ArenaResource arena(4096, &upstream);
+
+  const double* first = nullptr;
+  for (int request = 0; request < 3; ++request) {
+    S21Matrix<double> lhs(8, 8, 2.0, &arena);
+    S21Matrix<double> rhs(8, 8, 3.0, &arena);
+    S21Matrix<double> sum = lhs + rhs;
+    ASSERT_EQ(sum.GetResource(), &arena);
+    ASSERT_EQ(sum(2, 2), 5);
+    if (!first) first = &lhs(0, 0);
+    ASSERT_EQ(&lhs(0, 0), first);  // every request starts over
+    ASSERT_GE(arena.GetUsed(), 3 * 64 * sizeof(double));
+    lhs = S21Matrix<double>(), rhs = S21Matrix<double>();
+    arena.Reset();
+    ASSERT_EQ(arena.GetUsed(), 0u);
+  }
+  ASSERT_EQ(upstream.allocations, 1u);
+
+  // larger than a block: the arena grows
+  S21Matrix<double> big(100, 100, 1.0, &arena);
+  ASSERT_EQ(big(99, 99), 1);
+  ASSERT_EQ(upstream.allocations, 2u);
+
+  big = S21Matrix<double>();
+  arena.Release();
+  ASSERT_EQ(upstream.bytes_in_use, 0u);
+}
+
+TEST(MatrixMemory, SmallMatricesStayInline) {
+  CountingResource counting;
+  {
+    S21Matrix<double> mtx = MakeInvertible(4, &counting);
+    S21Matrix<double> res = (mtx + mtx) * mtx.InverseMatrix();
+    res = res.Transpose() * 0.5;
+    ASSERT_NEAR(res(2, 2), 1, 1e-12);
+    ASSERT_NEAR(res(2, 1), 0, 1e-12);
+    ASSERT_EQ(res.GetResource(), &counting);
+    S21Matrix<int> empty_row(1, 0, &counting);
+    ASSERT_TRUE(empty_row);
+    ASSERT_EQ(counting.allocations, 0u);
+
+    S21Matrix<long double> large(4, 4, &counting);  // 256 bytes
+    ASSERT_EQ(counting.allocations, 1u);
+  }
+  ASSERT_EQ(counting.deallocations, 1u);
+}
+
+TEST(MatrixMemory, MovesBetweenInlineAndHeapStorage) {
+  S21Matrix<double> small(2, 3, 1.0);
+  S21Matrix<double> tiny(1, 2, 2.0);
+  S21Matrix<double> big(10, 10, 3.0);
+
+  std::swap(small, tiny);  // inline <-> inline of different sizes
+  ASSERT_EQ(small, S21Matrix<double>(1, 2, 2.0));
+  ASSERT_EQ(tiny, S21Matrix<double>(2, 3, 1.0));
+
+  std::swap(small, big);  // inline <-> heap
+  ASSERT_EQ(small, S21Matrix<double>(10, 10, 3.0));
+  ASSERT_EQ(big, S21Matrix<double>(1, 2, 2.0));
+
+  S21Matrix<double> moved(std::move(big));
+  ASSERT_EQ(moved, S21Matrix<double>(1, 2, 2.0));
+  ASSERT_FALSE(big);
+  moved(0, 1) = 5;
+  big = moved;
+  ASSERT_EQ(big(0, 1), 5);
+}
+
+TEST(MatrixMemory, DyingOperandsAreRecycled) {
+  CountingResource res;
+  S21Matrix<double> a = MakeInvertible(40, &res);
+  S21Matrix<double> b = MakeInvertible(40, &res);
+  S21Matrix<double> c = MakeInvertible(40, &res);
+  S21Matrix<double> ab = a * b;
+  S21Matrix<double> bc = b * c;
+
+  auto allocations_of = [&](auto&& make, const S21Matrix<double>& expected) {
+    size_t before = res.allocations;
+    S21Matrix<double> result = make();
+    EXPECT_EQ(result, expected);
+    return res.allocations - before;
+  };
+  // one allocation per product, which then takes the rest in place
+  ASSERT_EQ(allocations_of([&] { return (a * b) + c; }, ab + c), 1u);
+  ASSERT_EQ(allocations_of([&] { return c - (a * b); }, c - ab), 1u);
+  ASSERT_EQ(allocations_of([&] { return (a * b) - (b * c); }, ab - bc), 2u);
+  ASSERT_EQ(allocations_of([&] { return 2.0 * (a * b) * 0.5; }, ab), 1u);
+  ASSERT_EQ(allocations_of([&] { return (a * b) * c; }, ab * c), 1u);
+  ASSERT_EQ(allocations_of([&] { return a * (b * c); }, a * bc), 1u);
+  ASSERT_EQ(allocations_of([&] { return (a * b) * (b * c); }, ab * bc), 2u);
+
+  // a product of another shape needs storage of its own
+  S21Matrix<double> wide(40, 50, 1.0, &res);
+  ASSERT_EQ(allocations_of([&] { return (a * b) * wide; }, ab * wide), 2u);
+
+  size_t before = res.allocations;
+  S21Matrix<double> copy = a;
+  copy.MulMatrix(b);
+  copy *= c;
+  ASSERT_EQ(res.allocations - before, 1u);
+  ASSERT_EQ(copy, ab * c);
+  ASSERT_EQ(std::move(copy) * copy, (ab * c) * (ab * c));
+}
+
+TEST(MatrixMemory, ProductsOverAnOperandMatchRegularOnes) {
+  // several row and column blocks on the packed path
+  S21Matrix<double> tall(1000, 70);
+  S21Matrix<double> square(70, 70);
+  S21Matrix<double> wide(70, 600);
+  for (size_t r = 0; r < 1000; ++r) {
+    for (size_t c = 0; c < 70; ++c) tall(r, c) = 1.0 / (r + c + 1);
+  }
+  for (size_t r = 0; r < 70; ++r) {
+    for (size_t c = 0; c < 600; ++c) {
+      wide(r, c) = 1.0 / (3 * r + c + 1);
+      if (c < 70) square(r, c) = 1.0 / (r + 2 * c + 1);
+    }
+  }
+  auto bitwise_equal = [](const S21Matrix<double>& lhs,
+                          const S21Matrix<double>& rhs) {
+    for (size_t r = 0; r < lhs.GetRows(); ++r) {
+      if (!std::equal(lhs.RowData(r), lhs.RowData(r) + lhs.GetCols(),
+                      rhs.RowData(r))) {
+        return false;
+      }
+    }
+    return true;
+  };
+  S21Matrix<double> left = tall * square;
+  ASSERT_TRUE(bitwise_equal(S21Matrix<double>(tall) * square, left));
+  ASSERT_TRUE(bitwise_equal(square * S21Matrix<double>(wide), square * wide));
+  S21Matrix<double> in_place = tall;
+  in_place.MulMatrix(square);
+  ASSERT_TRUE(bitwise_equal(in_place, left));
+}
@@ -0,0 +1,112 @@
+#include <gtest/gtest.h>
+
+#include <cstdint>
+#include <type_traits>
+
+#include "s21_matrix_oop.h"
+
+namespace {
+
+template <typename T>
+S21Matrix<T> MakeFilled(size_t rows, size_t cols, double start) {
+  S21Matrix<T> mtx(rows, cols);
+  for (size_t r = 0; r < rows; ++r) {
+    for (size_t c = 0; c < cols; ++c) {
+      mtx(r, c) = static_cast<T>(start + static_cast<double>(r * cols + c));
+    }
+  }
+  return mtx;
+}
+
+// 2^24 followed by ones: adding 1 to it in float is lost to rounding
+S21Matrix<float> MakeCancellingRow(size_t cols) {
+  S21Matrix<float> row(1, cols, 1.0f);
+  row(0, 0) = 16777216.0f;
+  return row;
+}
+
+}  // namespace
+
+TEST(MatrixMixed, PromotionFollowsArithmeticConversions) {
+  ASSERT_TRUE((std::is_same_v<s21::Promoted<float, double>, double>));
+  ASSERT_TRUE((std::is_same_v<s21::Promoted<int, float>, float>));
+  ASSERT_TRUE((std::is_same_v<s21::Promoted<std::int16_t, int>, int>));
+  ASSERT_TRUE((std::is_same_v<s21::AccumulatorOf<float>, float>));
+}
+
+TEST(MatrixMixed, ConvertingConstructor) {
+  S21Matrix<double> src = MakeFilled<double>(3, 20, 0.75);
+  S21Matrix<float> narrow(src);
+  S21Matrix<int> truncated(src);
+  for (size_t r = 0; r < 3; ++r) {
+    for (size_t c = 0; c < 20; ++c) {
+      ASSERT_FLOAT_EQ(narrow(r, c), static_cast<float>(src(r, c)));
+      ASSERT_EQ(truncated(r, c), static_cast<int>(src(r, c)));
+    }
+  }
+
+  S21Matrix<double> block(src.Block(1, 2, 2, 3));
+  ASSERT_EQ(block, S21Matrix<double>(src.Block(1, 2, 2, 3)));
+  S21Matrix<float> from_view(src.Block(1, 2, 2, 3));
+  ASSERT_FLOAT_EQ(from_view(1, 2), static_cast<float>(src(2, 4)));
+  ASSERT_FALSE((std::is_convertible_v<S21Matrix<double>, S21Matrix<float>>));
+}
+
+TEST(MatrixMixed, ConvertingConstructorKeepsResource) {
+  std::pmr::monotonic_buffer_resource pool;
+  S21Matrix<int> src(10, 10, 3, &pool);
+  S21Matrix<double> same_resource(src);
+  ASSERT_EQ(same_resource.GetResource(), &pool);
+  S21Matrix<double> other_resource(src, std::pmr::new_delete_resource());
+  ASSERT_EQ(other_resource.GetResource(), std::pmr::new_delete_resource());
+  ASSERT_EQ(other_resource(9, 9), 3.0);
+}
+
+TEST(MatrixMixed, ElementWiseExpressionsArePromoted) {
+  S21Matrix<float> a = MakeFilled<float>(4, 5, 0.5);
+  S21Matrix<double> b = MakeFilled<double>(4, 5, 0.25);
+  S21Matrix<int> n = MakeFilled<int>(4, 5, 1.0);
+
+  auto sum = a + b;
+  ASSERT_TRUE((std::is_same_v<decltype(sum)::value_type, double>));
+  S21Matrix<double> res = a + b - n;
+  for (size_t r = 0; r < 4; ++r) {
+    for (size_t c = 0; c < 5; ++c) {
+      ASSERT_DOUBLE_EQ(res(r, c), double{a(r, c)} + b(r, c) - n(r, c));
+    }
+  }
+  ASSERT_THROW(a + S21Matrix<double>(5, 4), std::logic_error);
+}
+
+TEST(MatrixMixed, MixedEqualityAndProduct) {
+  S21Matrix<int> n = MakeFilled<int>(3, 4, 1.0);
+  S21Matrix<double> d(n);
+  ASSERT_TRUE(n == d);
+  d(2, 3) += 0.5;
+  ASSERT_FALSE(d == n);
+
+  S21Matrix<float> f = MakeFilled<float>(4, 2, 0.5);
+  auto product = n * f;
+  ASSERT_TRUE((std::is_same_v<decltype(product), S21Matrix<float>>));
+  S21Matrix<float> expected = S21Matrix<float>(n) * f;
+  ASSERT_EQ(product, expected);
+}
+
+TEST(MatrixMixed, WideAccumulatorKeepsSmallTerms) {
+  // 1 x 101 and 1 x 40001 rows cover the unpacked and the packed product
+  for (size_t cols : {101u, 40001u}) {
+    S21Matrix<float> row = MakeCancellingRow(cols);
+    S21Matrix<float> ones(cols, 1, 1.0f);
+
+    S21Matrix<float> in_float = row;
+    in_float.MulMatrix(ones);
+    ASSERT_LT(in_float(0, 0), 16777216.0f + static_cast<float>(cols - 1));
+
+    S21Matrix<float> in_double = row;
+    in_double.MulMatrix<double>(ones);
+    ASSERT_EQ(in_double(0, 0), 16777216.0f + static_cast<float>(cols - 1));
+
+    S21Matrix<float> via_view = row.View().MulMatrix<double>(ones.View());
+    ASSERT_EQ(via_view, in_double);
+  }
+}
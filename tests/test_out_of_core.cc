@@ -0,0 +1,174 @@
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <iterator>
+#include <string>
+#include <vector>
+
+#include "s21_matrix_out_of_core.h"
+
+namespace {
+
+template <typename T>
+S21Matrix<T> MakeMatrix(size_t rows, size_t cols, unsigned seed) {
+  S21Matrix<T> mtx(rows, cols);
+  for (size_t r = 0; r < rows; ++r) {
+    for (size_t c = 0; c < cols; ++c) {
+      seed = seed * 1103515245u + 12345u;
+      mtx(r, c) = static_cast<T>(static_cast<int>((seed >> 8) % 19) - 9);
+    }
+  }
+  return mtx;
+}
+
+// a file removed when the test ends
+class TempFile {
+ public:
+  explicit TempFile(const std::string& name)
+      : _path((std::filesystem::temp_directory_path() / name).string()) {}
+  ~TempFile() { std::filesystem::remove(_path); }
+  const std::string& Path() const { return _path; }
+
+ private:
+  std::string _path;
+};
+
+double MaxDifference(const S21Matrix<double>& lhs,
+                     const S21Matrix<double>& rhs) {
+  double diff = 0.0;
+  for (size_t r = 0; r < lhs.GetRows(); ++r) {
+    for (size_t c = 0; c < lhs.GetCols(); ++c) {
+      diff = std::max(diff, std::fabs(lhs(r, c) - rhs(r, c)));
+    }
+  }
+  return diff;
+}
+
+}  // namespace
+
+TEST(MatrixOutOfCore, MatchesMulMatrixWithinTheBudget) {
+  TempFile lhs("s21_ooc_lhs.bin"), rhs("s21_ooc_rhs.bin");
+  TempFile out("s21_ooc_out.bin");
+  struct Shape {
+    size_t m, k, n;
+  };
+  for (Shape s : {Shape{60, 45, 70}, Shape{1, 90, 33}, Shape{80, 3, 2}}) {
+    S21Matrix<double> a = MakeMatrix<double>(s.m, s.k, 1);
+    S21Matrix<double> b = MakeMatrix<double>(s.k, s.n, 2);
+    s21::SaveBinary(lhs.Path(), a);
+    s21::SaveBinary(rhs.Path(), b);
+    for (bool prefetch : {true, false}) {
+      s21::OutOfCoreOptions options{4096, prefetch};
+      s21::OutOfCoreReport report = s21::OutOfCoreMulMatrix<double>(
+          lhs.Path(), rhs.Path(), out.Path(), options);
+      ASSERT_LE(report.buffer_bytes, options.memory_budget);
+      ASSERT_EQ(report.bytes_written,
+                sizeof(s21::BinaryHeader) + s.m * s.n * sizeof(double));
+      S21Matrix<double> res = s21::LoadBinary<double>(out.Path());
+      ASSERT_EQ(res.GetRows(), s.m);
+      ASSERT_EQ(res.GetCols(), s.n);
+      ASSERT_LT(MaxDifference(res, a * b), 1e-9);
+    }
+  }
+}
+
+TEST(MatrixOutOfCore, SmallBudgetsRereadTheOperands) {
+  TempFile lhs("s21_ooc_lhs.bin"), rhs("s21_ooc_rhs.bin");
+  TempFile out("s21_ooc_out.bin");
+  S21Matrix<std::int64_t> a = MakeMatrix<std::int64_t>(50, 40, 3);
+  S21Matrix<std::int64_t> b = MakeMatrix<std::int64_t>(40, 30, 4);
+  s21::SaveBinary(lhs.Path(), a);
+  s21::SaveBinary(rhs.Path(), b);
+  uint64_t operands = (50 * 40 + 40 * 30) * sizeof(std::int64_t);
+
+  s21::OutOfCoreReport large = s21::OutOfCoreMulMatrix<std::int64_t>(
+      lhs.Path(), rhs.Path(), out.Path(), {1 << 20, true});
+  ASSERT_EQ(large.tile_rows, 50u);
+  ASSERT_EQ(large.tile_inner, 40u);
+  ASSERT_EQ(large.tile_cols, 30u);
+  ASSERT_EQ(large.bytes_read, operands);
+
+  s21::OutOfCoreReport small = s21::OutOfCoreMulMatrix<std::int64_t>(
+      lhs.Path(), rhs.Path(), out.Path(), {2000, true});
+  ASSERT_LT(small.tile_rows * small.tile_cols, 50u * 30u);
+  ASSERT_GT(small.bytes_read, operands);
+  ASSERT_EQ(s21::LoadBinary<std::int64_t>(out.Path()), a * b);
+}
+
+TEST(MatrixOutOfCore, ReadsPaddedRows) {
+  TempFile lhs("s21_ooc_lhs.bin"), rhs("s21_ooc_rhs.bin");
+  TempFile out("s21_ooc_out.bin");
+  S21Matrix<float> a = MakeMatrix<float>(17, 13, 5);
+  S21Matrix<float> b = MakeMatrix<float>(13, 11, 6);
+  // rows 16 elements apart, the elements at byte 128
+  s21::BinaryHeader header = s21::detail::MakeBinaryHeader<float>(17, 13);
+  header.stride = 16;
+  header.data_offset = 128;
+  std::vector<float> elements(17 * 16, -1.0f);
+  for (size_t r = 0; r < 17; ++r) {
+    std::copy_n(a.RowData(r), 13, elements.data() + r * 16);
+  }
+  {
+    std::ofstream file(lhs.Path(), std::ios::binary);
+    std::vector<char> gap(header.data_offset - sizeof(header));
+    file.write(reinterpret_cast<const char*>(&header), sizeof(header));
+    file.write(gap.data(), gap.size());
+    file.write(reinterpret_cast<const char*>(elements.data()),
+               elements.size() * sizeof(float));
+  }
+  s21::SaveBinary(rhs.Path(), b);
+  s21::OutOfCoreMulMatrix<float>(lhs.Path(), rhs.Path(), out.Path(),
+                                 {600, true});
+  ASSERT_EQ(s21::LoadBinary<float>(out.Path()), a * b);
+}
+
+TEST(MatrixOutOfCore, Errors) {
+  TempFile lhs("s21_ooc_lhs.bin"), rhs("s21_ooc_rhs.bin");
+  TempFile out("s21_ooc_out.bin");
+  s21::SaveBinary(lhs.Path(), MakeMatrix<double>(4, 5, 7));
+  s21::SaveBinary(rhs.Path(), MakeMatrix<double>(4, 5, 8));
+  ASSERT_THROW(
+      s21::OutOfCoreMulMatrix<double>(lhs.Path(), rhs.Path(), out.Path()),
+      std::logic_error);
+  ASSERT_THROW(
+      s21::OutOfCoreMulMatrix<float>(lhs.Path(), lhs.Path(), out.Path()),
+      std::runtime_error);
+
+  s21::SaveBinary(rhs.Path(), MakeMatrix<double>(5, 5, 8));
+  ASSERT_THROW(s21::OutOfCoreMulMatrix<double>(lhs.Path(), rhs.Path(),
+                                               out.Path(), {32, true}),
+               std::invalid_argument);
+  ASSERT_THROW(
+      s21::OutOfCoreMulMatrix<double>(lhs.Path(), rhs.Path(), rhs.Path()),
+      std::invalid_argument);
+  ASSERT_EQ(s21::LoadBinary<double>(rhs.Path()), MakeMatrix<double>(5, 5, 8));
+  ASSERT_THROW(s21::OutOfCoreMulMatrix<double>(lhs.Path() + ".missing",
+                                               rhs.Path(), out.Path()),
+               std::system_error);
+
+  // a corrupt offset whose extent wraps around is not read from
+  std::string bytes;
+  {
+    std::ifstream file(lhs.Path(), std::ios::binary);
+    bytes.assign(std::istreambuf_iterator<char>(file), {});
+  }
+  s21::BinaryHeader header;
+  std::memcpy(&header, bytes.data(), sizeof(header));
+  header.data_offset = UINT64_MAX - 63;
+  std::memcpy(bytes.data(), &header, sizeof(header));
+  std::ofstream(lhs.Path(), std::ios::binary | std::ios::trunc) << bytes;
+  ASSERT_THROW(
+      s21::OutOfCoreMulMatrix<double>(lhs.Path(), rhs.Path(), out.Path()),
+      std::runtime_error);
+
+  // an empty inner dimension gives zeros
+  s21::SaveBinary(lhs.Path(), S21Matrix<double>(3, 0));
+  s21::SaveBinary(rhs.Path(), S21Matrix<double>(0, 2));
+  s21::OutOfCoreMulMatrix<double>(lhs.Path(), rhs.Path(), out.Path());
+  ASSERT_EQ(s21::LoadBinary<double>(out.Path()), S21Matrix<double>(3, 2));
+}
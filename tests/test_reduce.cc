@@ -0,0 +1,239 @@
+#include <gtest/gtest.h>
+
+#include <cmath>
+#include <cstdint>
+#include <limits>
+#include <stdexcept>
+#include <tuple>
+
+#include "s21_matrix_oop.h"
+
+namespace {
+
+using s21::simd::Isa;
+
+constexpr Isa kAllIsas[] = {Isa::kScalar, Isa::kSse2, Isa::kAvx2,
+                            Isa::kAvx512};
+
+// restores the detected instruction set when the test ends
+class IsaGuard {
+ public:
+  IsaGuard() : _saved(s21::simd::ActiveIsa()) {}
+  ~IsaGuard() { s21::simd::SetActiveIsa(_saved); }
+
+ private:
+  Isa _saved;
+};
+
+template <typename T>
+S21Matrix<T> MakeMatrix(size_t rows, size_t cols) {
+  S21Matrix<T> mtx(rows, cols);
+  unsigned seed = 11;
+  for (size_t r = 0; r < rows; ++r) {
+    for (size_t c = 0; c < cols; ++c) {
+      seed = seed * 1103515245u + 12345u;
+      mtx(r, c) = static_cast<T>(static_cast<int>((seed >> 8) % 2001) - 1000) /
+                  static_cast<T>(64);
+    }
+  }
+  return mtx;
+}
+
+// every reduction against a plain loop in long double
+template <typename V>
+void ExpectMatchesNaive(const V& view) {
+  using T = typename V::value_type;
+  size_t rows = view.GetRows(), cols = view.GetCols();
+  long double sum = 0, squares = 0, dot = 0, norm1 = 0, norm_inf = 0;
+  T min = view(0, 0), max = view(0, 0);
+  std::tuple<size_t, size_t> arg_min{0, 0}, arg_max{0, 0};
+  S21Matrix<T> row_sums = view.RowSums(), col_sums = view.ColSums();
+  for (size_t r = 0; r < rows; ++r) {
+    long double row_sum = 0, row_abs = 0;
+    for (size_t c = 0; c < cols; ++c) {
+      long double x = view(r, c);
+      sum += x;
+      squares += x * x;
+      dot += x * (x + 1);
+      row_sum += x;
+      row_abs += std::fabs(x);
+      if (view(r, c) < min) {
+        min = view(r, c);
+        arg_min = {r, c};
+      }
+      if (max < view(r, c)) {
+        max = view(r, c);
+        arg_max = {r, c};
+      }
+    }
+    norm_inf = std::max(norm_inf, row_abs);
+    EXPECT_NEAR(row_sums(r, 0), row_sum, 1e-9);
+  }
+  for (size_t c = 0; c < cols; ++c) {
+    long double col_sum = 0, col_abs = 0;
+    for (size_t r = 0; r < rows; ++r) {
+      col_sum += view(r, c);
+      col_abs += std::fabs(static_cast<long double>(view(r, c)));
+    }
+    norm1 = std::max(norm1, col_abs);
+    EXPECT_NEAR(col_sums(0, c), col_sum, 1e-9);
+  }
+  S21Matrix<T> shifted = view.ToMatrix();
+  for (size_t r = 0; r < rows; ++r) {
+    for (size_t c = 0; c < cols; ++c) shifted(r, c) += 1;
+  }
+  EXPECT_NEAR(view.Sum(), sum, 1e-9);
+  EXPECT_NEAR(view.Dot(shifted.View()), dot, 1e-6);
+  EXPECT_NEAR(view.NormFrobenius(), std::sqrt(squares), 1e-9);
+  EXPECT_NEAR(view.Norm1(), norm1, 1e-9);
+  EXPECT_NEAR(view.NormInf(), norm_inf, 1e-9);
+  EXPECT_EQ(view.Min(), min);
+  EXPECT_EQ(view.Max(), max);
+  EXPECT_EQ(view.ArgMin(), arg_min);
+  EXPECT_EQ(view.ArgMax(), arg_max);
+}
+
+}  // namespace
+
+TEST(MatrixReduce, MatchesNaiveLoops) {
+  // one piece, several pieces, rows longer than a piece
+  for (auto [rows, cols] : {std::pair<size_t, size_t>{3, 5}, {37, 1111},
+                            {2, 9000}, {1500, 3}}) {
+    S21Matrix<double> mtx = MakeMatrix<double>(rows, cols);
+    ExpectMatchesNaive(mtx.View());
+  }
+  // strided blocks, a single column
+  S21Matrix<double> mtx = MakeMatrix<double>(130, 270);
+  ExpectMatchesNaive(mtx.Block(3, 5, 120, 201));
+  ExpectMatchesNaive(mtx.Col(17));
+  ExpectMatchesNaive(mtx.Row(99));
+}
+
+TEST(MatrixReduce, Trace) {
+  S21Matrix<double> mtx = MakeMatrix<double>(300, 300);
+  long double trace = 0;
+  for (size_t i = 0; i < 300; ++i) trace += mtx(i, i);
+  ASSERT_NEAR(mtx.Trace(), trace, 1e-9);
+  // the diagonal of a block of a padded matrix
+  ASSERT_DOUBLE_EQ(mtx.Block(1, 0, 2, 2).Trace(), mtx(1, 0) + mtx(2, 1));
+  ASSERT_EQ(S21Matrix<int>(0, 0).Trace(), 0);
+  ASSERT_THROW(S21Matrix<double>(2, 3).Trace(), std::logic_error);
+}
+
+TEST(MatrixReduce, PairwiseSummationIsAccurate) {
+  // 2^22 copies of 0.1f: a float running sum drifts by thousands as its
+  // ulp approaches the addend, the pairwise sum stays within a few ulps
+  constexpr size_t kCount = size_t{1} << 22;
+  S21Matrix<float> mtx(1024, kCount / 1024, 0.1f);
+  float naive = 0;
+  for (size_t r = 0; r < mtx.GetRows(); ++r) {
+    for (size_t c = 0; c < mtx.GetCols(); ++c) naive += mtx(r, c);
+  }
+  double exact = static_cast<double>(0.1f) * kCount;
+  ASSERT_GT(std::fabs(naive - exact), 1e4);
+  ASSERT_NEAR(mtx.Sum(), exact, exact * 1e-6);
+  ASSERT_NEAR(mtx.ColSums().Sum(), exact, exact * 1e-6);
+  ASSERT_NEAR(mtx.RowSums().Sum(), exact, exact * 1e-6);
+  ASSERT_NEAR(mtx.NormFrobenius(), std::sqrt(exact * 0.1f), 1e-2);
+}
+
+TEST(MatrixReduce, ResultsDoNotDependOnThreads) {
+  S21Matrix<float> mtx = MakeMatrix<float>(700, 3000);
+  auto block = mtx.Block(1, 2, 650, 2900);
+  auto reduce = [&] {
+    return std::make_tuple(mtx.Sum(), block.Sum(), mtx.Dot(mtx),
+                           block.NormFrobenius(), mtx.Norm1(), block.NormInf(),
+                           block.Min(), block.Max(), block.ArgMax(),
+                           block.RowSums(), block.ColSums());
+  };
+  auto serial = [&] {
+    s21::ScopedExecutionPolicy policy({1, 0});
+    return reduce();
+  }();
+  s21::ScopedExecutionPolicy policy({4, 0});
+  ASSERT_EQ(reduce(), serial);
+}
+
+TEST(MatrixReduce, InstructionSetsAgree) {
+  IsaGuard guard;
+  S21Matrix<double> mtx = MakeMatrix<double>(90, 333);
+  S21Matrix<int> integers = MakeMatrix<int>(90, 333);
+  s21::simd::SetActiveIsa(Isa::kScalar);
+  auto reduce = [&] {
+    return std::make_tuple(mtx.Sum(), mtx.Dot(mtx), mtx.NormFrobenius(),
+                           mtx.Norm1(), mtx.NormInf(), mtx.Min(), mtx.Max(),
+                           integers.Sum(), integers.Dot(integers),
+                           integers.Norm1(), integers.Min(), integers.Max());
+  };
+  auto scalar = reduce();
+  for (Isa isa : kAllIsas) {
+    if (!s21::simd::IsSupported(isa)) continue;
+    s21::simd::SetActiveIsa(isa);
+    EXPECT_EQ(reduce(), scalar) << s21::simd::IsaName(isa);
+  }
+}
+
+TEST(MatrixReduce, Integers) {
+  S21Matrix<int> mtx(2, 3);
+  mtx(0, 0) = std::numeric_limits<int>::min();
+  mtx(0, 2) = 7;
+  mtx(1, 1) = -3;
+  // norms are computed in double, so the magnitude of INT_MIN is exact
+  ASSERT_DOUBLE_EQ(mtx.NormInf(), 2147483648.0 + 7);
+  ASSERT_DOUBLE_EQ(mtx.Norm1(), 2147483648.0);
+  ASSERT_EQ(mtx.Min(), std::numeric_limits<int>::min());
+  ASSERT_EQ(mtx.ArgMax(), std::make_tuple(size_t{0}, size_t{2}));
+  ASSERT_EQ(mtx.ArgMin(), std::make_tuple(size_t{0}, size_t{0}));
+
+  S21Matrix<std::uint8_t> bytes(40, 50, std::uint8_t{200});
+  ASSERT_DOUBLE_EQ(bytes.NormFrobenius(), 200.0 * std::sqrt(2000.0));
+  ASSERT_EQ(bytes.Max(), 200);
+  ASSERT_EQ(S21Matrix<long>(1000, 1000, 3L).Sum(), 3000000L);
+}
+
+TEST(MatrixReduce, IntegerSumsDoNotOverflow) {
+  // sums of small integers are computed in 64 bits of their signedness
+  S21Matrix<std::uint8_t> bytes(40, 50, std::uint8_t{200});
+  ASSERT_EQ(bytes.Sum(), 400000u);
+  ASSERT_EQ(bytes.Dot(bytes), 80000000u);
+  ASSERT_EQ(bytes.RowSums()(0, 0), 10000u);
+  ASSERT_EQ(bytes.ColSums()(0, 0), 8000u);
+  ASSERT_EQ(S21Matrix<std::uint8_t>(3, 3, std::uint8_t{255}).Trace(), 765u);
+
+  S21Matrix<int> ints(3, 3000, std::numeric_limits<int>::max());
+  ASSERT_EQ(ints.Sum(), std::int64_t{9000} * std::numeric_limits<int>::max());
+  ints(0, 0) = std::numeric_limits<int>::min();
+  ASSERT_EQ(ints.Block(0, 0, 1, 2).Sum(), -1);
+  S21Matrix<std::int8_t> small(100, 100, std::int8_t{-100});
+  ASSERT_EQ(small.Dot(small), 100000000);
+
+  S21Matrix<bool> flags(10, 7, true);
+  flags(3, 4) = false;
+  ASSERT_EQ(flags.Sum(), 69u);
+}
+
+TEST(MatrixReduce, ArgMaxFindsTheFirstOccurrence) {
+  S21Matrix<double> mtx(4, 5, 1.0);
+  mtx(2, 1) = 9;
+  mtx(3, 0) = 9;
+  mtx(1, 4) = -2;
+  mtx(3, 3) = -2;
+  ASSERT_EQ(mtx.ArgMax(), std::make_tuple(size_t{2}, size_t{1}));
+  ASSERT_EQ(mtx.ArgMin(), std::make_tuple(size_t{1}, size_t{4}));
+  ASSERT_EQ(mtx.Block(3, 0, 1, 5).ArgMax(),
+            std::make_tuple(size_t{0}, size_t{0}));
+}
+
+TEST(MatrixReduce, EmptyAndMismatched) {
+  S21Matrix<double> empty(0, 4);
+  ASSERT_EQ(empty.Sum(), 0);
+  ASSERT_EQ(empty.NormFrobenius(), 0);
+  ASSERT_EQ(empty.Norm1(), 0);
+  ASSERT_EQ(empty.NormInf(), 0);
+  ASSERT_EQ(empty.ColSums(), S21Matrix<double>(1, 4));
+  ASSERT_THROW(empty.Min(), std::out_of_range);
+  ASSERT_THROW(empty.Max(), std::out_of_range);
+  ASSERT_THROW(empty.ArgMax(), std::out_of_range);
+  ASSERT_THROW(S21Matrix<double>(2, 3).Dot(S21Matrix<double>(3, 2)),
+               std::logic_error);
+}
@@ -0,0 +1,169 @@
+#include <gtest/gtest.h>
+
+#include <cstring>
+#include <vector>
+
+#include "s21_matrix_oop.h"
+
+namespace {
+
+using s21::simd::Isa;
+
+const Isa kAllIsas[] = {Isa::kScalar, Isa::kSse2, Isa::kAvx2, Isa::kAvx512};
+
+// Restores the detected instruction set when a test is done.
+class IsaGuard {
+ public:
+  IsaGuard() : _saved(s21::simd::ActiveIsa()) {}
+  ~IsaGuard() { s21::simd::SetActiveIsa(_saved); }
+
+ private:
+  Isa _saved;
+};
+
+template <typename T>
+S21Matrix<T> MakeNoise(size_t rows, size_t cols, unsigned seed) {
+  S21Matrix<T> mtx(rows, cols);
+  for (size_t r = 0; r < rows; ++r) {
+    for (size_t c = 0; c < cols; ++c) {
+      seed = seed * 1103515245u + 12345u;
+      long value = static_cast<long>((seed >> 8) % 2001) - 1000;
+      if constexpr (std::is_floating_point_v<T>) {
+        mtx(r, c) = static_cast<T>(value) / T(7);
+      } else {
+        mtx(r, c) = static_cast<T>(value);
+      }
+    }
+  }
+  return mtx;
+}
+
+template <typename T>
+bool BitwiseEqual(const S21Matrix<T>& lhs, const S21Matrix<T>& rhs) {
+  if (!lhs.IsEqualSize(rhs)) return false;
+  for (size_t r = 0; r < lhs.GetRows(); ++r) {
+    for (size_t c = 0; c < lhs.GetCols(); ++c) {
+      if constexpr (std::is_same_v<T, long double>) {
+        // the x87 format leaves padding bytes undefined
+        if (lhs(r, c) != rhs(r, c)) return false;
+      } else if (std::memcmp(&lhs(r, c), &rhs(r, c), sizeof(T))) {
+        return false;
+      }
+    }
+  }
+  return true;
+}
+
+template <typename T>
+void ExpectAllIsasAgree() {
+  IsaGuard guard;
+  // 67 columns leave a scalar tail behind every vector width
+  S21Matrix<T> lhs = MakeNoise<T>(5, 67, 1);
+  S21Matrix<T> rhs = MakeNoise<T>(5, 67, 2);
+  S21Matrix<T> near_head = lhs;
+  near_head(0, 1) += 1;
+  S21Matrix<T> near_tail = lhs;
+  near_tail(4, 66) += 1;
+
+  auto sum = [&] {
+    S21Matrix<T> res = lhs;
+    res.SumMatrix(rhs);
+    return res;
+  };
+  auto sub = [&] {
+    S21Matrix<T> res = lhs;
+    res.SubMatrix(rhs);
+    return res;
+  };
+  auto scale = [&] {
+    S21Matrix<T> res = lhs;
+    res.MulNumber(0.37L);
+    return res;
+  };
+
+  s21::simd::SetActiveIsa(Isa::kScalar);
+  S21Matrix<T> sum_ans = sum();
+  S21Matrix<T> sub_ans = sub();
+  S21Matrix<T> scale_ans = scale();
+  // the fused expression path rounds exactly like the kernels
+  ASSERT_TRUE(BitwiseEqual<T>(lhs + rhs, sum_ans));
+  ASSERT_TRUE(BitwiseEqual<T>(lhs - rhs, sub_ans));
+  ASSERT_TRUE(BitwiseEqual<T>(lhs * 0.37L, scale_ans));
+
+  for (Isa isa : kAllIsas) {
+    if (!s21::simd::IsSupported(isa)) continue;
+    SCOPED_TRACE(s21::simd::IsaName(isa));
+    s21::simd::SetActiveIsa(isa);
+    ASSERT_TRUE(BitwiseEqual(sum(), sum_ans));
+    ASSERT_TRUE(BitwiseEqual(sub(), sub_ans));
+    ASSERT_TRUE(BitwiseEqual(scale(), scale_ans));
+    ASSERT_TRUE(lhs.EqMatrix(lhs));
+    ASSERT_FALSE(lhs.EqMatrix(rhs));
+    ASSERT_FALSE(lhs.EqMatrix(near_head));
+    ASSERT_FALSE(lhs.EqMatrix(near_tail));
+    ASSERT_FALSE(near_tail.EqMatrix(lhs));
+  }
+}
+
+}  // namespace
+
+TEST(MatrixSimd, DetectedIsaIsActiveAndSupported) {
+  ASSERT_TRUE(s21::simd::IsSupported(Isa::kScalar));
+  ASSERT_TRUE(s21::simd::IsSupported(s21::simd::DetectIsa()));
+  ASSERT_TRUE(s21::simd::IsSupported(s21::simd::ActiveIsa()));
+}
+
+TEST(MatrixSimd, UnsupportedIsaIsRejected) {
+  IsaGuard guard;
+  for (Isa isa : kAllIsas) {
+    if (s21::simd::IsSupported(isa)) {
+      ASSERT_NO_THROW(s21::simd::SetActiveIsa(isa));
+    } else {
+      ASSERT_THROW(s21::simd::SetActiveIsa(isa), std::invalid_argument);
+    }
+  }
+}
+
+TEST(MatrixSimd, AllPathsGiveIdenticalResults) {
+  ExpectAllIsasAgree<float>();
+  ExpectAllIsasAgree<double>();
+  ExpectAllIsasAgree<long double>();
+  ExpectAllIsasAgree<signed char>();
+  ExpectAllIsasAgree<unsigned char>();
+  ExpectAllIsasAgree<short>();
+  ExpectAllIsasAgree<int>();
+  ExpectAllIsasAgree<unsigned>();
+  ExpectAllIsasAgree<long>();
+}
+
+TEST(MatrixSimd, EqMatrixToleranceIsTheSameOnEveryPath) {
+  IsaGuard guard;
+  const double eps = std::numeric_limits<double>::epsilon();
+  S21Matrix<double> lhs(3, 17, 1.0);
+  S21Matrix<double> rhs = lhs;
+  rhs(2, 16) = 1.0 + eps;  // |diff| == eps is still equal
+  // floats default to the float epsilon; a double one is rounded down to
+  // the float threshold that gives the same answer
+  const float feps = std::numeric_limits<float>::epsilon();
+  S21Matrix<float> flhs(3, 33, 1.0f);
+  S21Matrix<float> frhs = flhs;
+  frhs(1, 3) = 1.0f + feps;
+  S21Matrix<float> fzeros(3, 33, 0.0f);
+  S21Matrix<float> ftiny = fzeros;
+  ftiny(1, 3) = static_cast<float>(eps) * 2;
+
+  for (Isa isa : kAllIsas) {
+    if (!s21::simd::IsSupported(isa)) continue;
+    SCOPED_TRACE(s21::simd::IsaName(isa));
+    s21::simd::SetActiveIsa(isa);
+    ASSERT_TRUE(lhs == rhs);
+    rhs(2, 16) = 1.0 + 2 * eps;
+    ASSERT_FALSE(lhs == rhs);
+    rhs(2, 16) = 1.0 + eps;
+    ASSERT_TRUE(flhs == frhs);
+    frhs(1, 3) = 1.0f + 2 * feps;
+    ASSERT_FALSE(flhs == frhs);
+    frhs(1, 3) = 1.0f + feps;
+    ASSERT_FALSE(fzeros.EqMatrix(ftiny, s21::AbsoluteTolerance{eps}));
+  }
+}
@@ -0,0 +1,145 @@
+#include <gtest/gtest.h>
+
+#include <memory_resource>
+#include <vector>
+
+#include "s21_matrix_sparse.h"
+
+namespace {
+
+using Csr = S21SparseMatrix<double>;
+using Csc = S21SparseMatrix<double, s21::SparseLayout::kCsc>;
+
+// about one element in `period` is nonzero
+S21Matrix<double> MakeSparseDense(size_t rows, size_t cols, unsigned period,
+                                  unsigned seed) {
+  S21Matrix<double> mtx(rows, cols);
+  for (size_t r = 0; r < rows; ++r) {
+    for (size_t c = 0; c < cols; ++c) {
+      seed = seed * 1103515245u + 12345u;
+      if ((seed >> 8) % period == 0) mtx(r, c) = (seed >> 16) % 19 - 9.0;
+    }
+  }
+  return mtx;
+}
+
+}  // namespace
+
+TEST(MatrixSparse, DenseRoundTrip) {
+  auto dense = MakeSparseDense(30, 40, 7, 1);
+  Csr csr(dense);
+  Csc csc(dense);
+  EXPECT_TRUE(csr.ToDense() == dense);
+  EXPECT_TRUE(csc.ToDense() == dense);
+  size_t nonzeros = 0;
+  for (size_t r = 0; r < 30; ++r) {
+    for (size_t c = 0; c < 40; ++c) nonzeros += dense(r, c) != 0.0;
+  }
+  EXPECT_EQ(csr.GetNonZeros(), nonzeros);
+  EXPECT_EQ(csc.GetNonZeros(), nonzeros);
+  EXPECT_EQ(csr.GetOffsets().size(), 31u);
+  EXPECT_EQ(csc.GetOffsets().size(), 41u);
+}
+
+TEST(MatrixSparse, CompressedLayout) {
+  S21Matrix<double> dense(2, 3);
+  dense(0, 2) = 5.0;
+  dense(1, 0) = 6.0;
+  dense(1, 1) = 7.0;
+  Csr csr(dense);
+  EXPECT_EQ(csr.GetOffsets(), (std::pmr::vector<size_t>{0, 1, 3}));
+  EXPECT_EQ(csr.GetIndices(), (std::pmr::vector<size_t>{2, 0, 1}));
+  EXPECT_EQ(csr.GetValues(), (std::pmr::vector<double>{5, 6, 7}));
+  auto csc = csr.ToCsc();
+  EXPECT_EQ(csc.GetOffsets(), (std::pmr::vector<size_t>{0, 1, 2, 3}));
+  EXPECT_EQ(csc.GetIndices(), (std::pmr::vector<size_t>{1, 1, 0}));
+  EXPECT_EQ(csc.GetValues(), (std::pmr::vector<double>{6, 7, 5}));
+  EXPECT_TRUE(csc.ToCsr().ToDense() == dense);
+}
+
+TEST(MatrixSparse, Triplets) {
+  auto mtx = Csr::FromTriplets(
+      3, 3, {{2, 1, 1.0}, {0, 0, 2.0}, {2, 1, 3.0}, {1, 2, 4.0}, {1, 2, -4.0}});
+  EXPECT_EQ(mtx.GetNonZeros(), 2u);
+  EXPECT_EQ(mtx.At(2, 1), 4.0);
+  EXPECT_EQ(mtx.At(0, 0), 2.0);
+  EXPECT_EQ(mtx.At(1, 2), 0.0);
+  auto csc = Csc::FromTriplets(3, 3, {{2, 1, 1.0}, {0, 1, 2.0}});
+  EXPECT_EQ(csc.At(0, 1), 2.0);
+  EXPECT_EQ(csc.GetIndices()[0], 0u);
+  EXPECT_THROW(Csr::FromTriplets(2, 2, {{2, 0, 1.0}}), std::out_of_range);
+  EXPECT_THROW(mtx.At(0, 3), std::out_of_range);
+}
+
+TEST(MatrixSparse, MulVector) {
+  auto dense = MakeSparseDense(50, 35, 5, 2);
+  std::vector<double> x(35), y(50), expected(50);
+  for (size_t i = 0; i < x.size(); ++i) x[i] = 0.5 * i - 3.0;
+  for (size_t r = 0; r < 50; ++r) {
+    for (size_t c = 0; c < 35; ++c) expected[r] += dense(r, c) * x[c];
+  }
+  Csr(dense).MulVector(x.data(), y.data());
+  EXPECT_EQ(y, expected);
+  std::fill(y.begin(), y.end(), 99.0);
+  Csc(dense).MulVector(x.data(), y.data());
+  EXPECT_EQ(y, expected);
+}
+
+TEST(MatrixSparse, MulDenseMatrix) {
+  auto dense = MakeSparseDense(40, 60, 6, 3);
+  auto rhs = MakeSparseDense(60, 25, 1, 4);
+  auto expected = dense * rhs;
+  EXPECT_TRUE(Csr(dense) * rhs == expected);
+  EXPECT_TRUE(Csc(dense) * rhs == expected);
+  EXPECT_TRUE(Csr(dense) * rhs.Block(0, 0, 60, 10) ==
+              dense * rhs.Block(0, 0, 60, 10));
+  EXPECT_THROW(Csr(dense) * dense, std::logic_error);
+}
+
+TEST(MatrixSparse, SumAndSub) {
+  auto lhs = MakeSparseDense(20, 20, 4, 5);
+  auto rhs = MakeSparseDense(20, 20, 4, 6);
+  Csr a(lhs), b(rhs);
+  EXPECT_TRUE((a + b).ToDense() == lhs + rhs);
+  EXPECT_TRUE((a - b).ToDense() == lhs - rhs);
+  Csc c(lhs), d(rhs);
+  c += d;
+  EXPECT_TRUE(c.ToDense() == lhs + rhs);
+  // cancelled entries are dropped
+  a -= Csr(lhs);
+  EXPECT_EQ(a.GetNonZeros(), 0u);
+  EXPECT_THROW(a += Csr(3, 3), std::logic_error);
+}
+
+TEST(MatrixSparse, ResultsInheritTheResource) {
+  std::pmr::monotonic_buffer_resource arena;
+  auto dense = MakeSparseDense(9, 7, 3, 8);
+  Csr a(dense, &arena);
+  Csc c(dense, &arena);
+  EXPECT_EQ((a + a).GetAllocator().resource(), &arena);
+  EXPECT_EQ((a - a).GetAllocator().resource(), &arena);
+  EXPECT_EQ(Csr(a).GetAllocator().resource(), &arena);
+  EXPECT_EQ(a.Transpose().GetAllocator().resource(), &arena);
+  EXPECT_EQ(a.ToCsc().GetAllocator().resource(), &arena);
+  EXPECT_EQ((c + c).GetAllocator().resource(), &arena);
+  EXPECT_EQ(a.ToDense().GetAllocator().resource(), &arena);
+}
+
+TEST(MatrixSparse, TransposeAndScale) {
+  auto dense = MakeSparseDense(13, 29, 3, 7);
+  auto t = Csr(dense).Transpose();
+  EXPECT_EQ(t.GetRows(), 29u);
+  EXPECT_TRUE(t.ToDense() == dense.Transpose());
+  EXPECT_TRUE(Csc(dense).Transpose().ToDense() == dense.Transpose());
+  Csr scaled(dense);
+  scaled *= 2.0;
+  EXPECT_TRUE(scaled.ToDense() == dense * 2.0);
+}
+
+TEST(MatrixSparse, Empty) {
+  Csr empty(4, 5);
+  EXPECT_EQ(empty.GetNonZeros(), 0u);
+  EXPECT_TRUE(empty.ToDense() == S21Matrix<double>(4, 5));
+  EXPECT_TRUE(empty * S21Matrix<double>(5, 2) == S21Matrix<double>(4, 2));
+  EXPECT_EQ(Csr().ToCsc().GetRows(), 0u);
+}
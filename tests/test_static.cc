@@ -0,0 +1,140 @@
+#include <gtest/gtest.h>
+
+#include <cmath>
+
+#include "s21_matrix_static.h"
+
+namespace {
+
+template <size_t N>
+S21StaticMatrix<double, N, N> MakeInvertible() {
+  S21StaticMatrix<double, N, N> mtx;
+  for (size_t r = 0; r < N; ++r) {
+    for (size_t c = 0; c < N; ++c) {
+      mtx(r, c) = (r == c) ? N + 1.0 : static_cast<double>((r * 7 + c) % 5);
+    }
+  }
+  return mtx;
+}
+
+template <size_t N>
+void ExpectMatchesDynamic() {
+  SCOPED_TRACE(N);
+  S21StaticMatrix<double, N, N> mtx = MakeInvertible<N>();
+  S21Matrix<double> dynamic = mtx.ToMatrix();
+  ASSERT_NEAR(mtx.Determinant() / dynamic.Determinant(), 1, 1e-12);
+
+  S21Matrix<double> inverse = mtx.InverseMatrix().ToMatrix();
+  S21Matrix<double> expected = dynamic.InverseMatrix();
+  S21Matrix<double> complements = mtx.CalcComplements().ToMatrix();
+  S21Matrix<double> expected_complements = dynamic.CalcComplements();
+  for (size_t r = 0; r < N; ++r) {
+    for (size_t c = 0; c < N; ++c) {
+      ASSERT_NEAR(inverse(r, c), expected(r, c), 1e-12);
+      ASSERT_NEAR(complements(r, c), expected_complements(r, c),
+                  1e-9 * std::fabs(expected_complements(r, c)) + 1e-9);
+    }
+  }
+  S21Matrix<double> identity =
+      (mtx * mtx.InverseMatrix() - S21StaticMatrix<double, N, N>::Identity())
+          .ToMatrix();
+  for (size_t r = 0; r < N; ++r) {
+    for (size_t c = 0; c < N; ++c) ASSERT_NEAR(identity(r, c), 0, 1e-14);
+  }
+  ASSERT_EQ((mtx * mtx).ToMatrix(), dynamic * dynamic);
+}
+
+}  // namespace
+
+TEST(MatrixStatic, ConstructionAndAccess) {
+  S21StaticMatrix<int, 2, 3> mtx;
+  ASSERT_EQ(mtx.GetRows(), 2u);
+  ASSERT_EQ(mtx.GetCols(), 3u);
+  ASSERT_EQ(mtx(1, 2), 0);
+  ASSERT_THROW(mtx(2, 0), std::out_of_range);
+  ASSERT_THROW(mtx(0, 3), std::out_of_range);
+
+  mtx.At<1, 2>() = 7;
+  ASSERT_EQ(mtx(1, 2), 7);
+  ASSERT_EQ((S21StaticMatrix<int, 2, 2>(5)(1, 0)), 5);
+
+  S21Matrix<int> dynamic = mtx.ToMatrix();
+  ASSERT_EQ(dynamic(1, 2), 7);
+  ASSERT_EQ((S21StaticMatrix<int, 2, 3>(dynamic)), mtx);
+  ASSERT_THROW((S21StaticMatrix<int, 3, 2>(dynamic)), std::logic_error);
+}
+
+TEST(MatrixStatic, ElementwiseOperations) {
+  S21StaticMatrix<double, 2, 2> lhs({1, 2, 3, 4});
+  S21StaticMatrix<double, 2, 2> rhs({0.5, -1, 2, 8});
+  ASSERT_EQ(lhs + rhs, (S21StaticMatrix<double, 2, 2>({1.5, 1, 5, 12})));
+  ASSERT_EQ(lhs - rhs, (S21StaticMatrix<double, 2, 2>({0.5, 3, 1, -4})));
+  ASSERT_EQ(2 * lhs, lhs * 2.0);
+  ASSERT_EQ(lhs * 2.0, (S21StaticMatrix<double, 2, 2>({2, 4, 6, 8})));
+  ASSERT_FALSE(lhs == rhs);
+
+  lhs += rhs;
+  lhs -= rhs;
+  lhs *= 0.5;
+  ASSERT_EQ(lhs, (S21StaticMatrix<double, 2, 2>({0.5, 1, 1.5, 2})));
+
+  // integers scale through long double like S21Matrix
+  S21StaticMatrix<int, 1, 2> ints({3, 5});
+  ints *= 0.5;
+  ASSERT_EQ(ints, (S21StaticMatrix<int, 1, 2>({1, 2})));
+}
+
+TEST(MatrixStatic, ToleranceMatchesDynamicMatrix) {
+  // one and two float ulps above 1
+  float one_ulp = std::nextafter(1.0f, 2.0f);
+  float two_ulps = std::nextafter(one_ulp, 2.0f);
+  S21StaticMatrix<float, 2, 2> lhs({1, 1, 1, 1});
+  for (float value : {one_ulp, two_ulps}) {
+    S21StaticMatrix<float, 2, 2> rhs({1, 1, 1, value});
+    EXPECT_EQ(lhs == rhs, lhs.ToMatrix() == rhs.ToMatrix()) << value;
+  }
+  EXPECT_TRUE(lhs == (S21StaticMatrix<float, 2, 2>({1, 1, 1, one_ulp})));
+  EXPECT_FALSE(lhs == (S21StaticMatrix<float, 2, 2>({1, 1, 1, two_ulps})));
+}
+
+TEST(MatrixStatic, MultiplicationAndTranspose) {
+  S21StaticMatrix<int, 2, 3> lhs({1, 2, 3, 4, 5, 6});
+  S21StaticMatrix<int, 3, 2> rhs = lhs.Transpose();
+  ASSERT_EQ(rhs, (S21StaticMatrix<int, 3, 2>({1, 4, 2, 5, 3, 6})));
+
+  S21StaticMatrix<int, 2, 2> product = lhs * rhs;
+  ASSERT_EQ(product, (S21StaticMatrix<int, 2, 2>({14, 32, 32, 77})));
+  product *= S21StaticMatrix<int, 2, 2>::Identity();
+  ASSERT_EQ(product, (S21StaticMatrix<int, 2, 2>({14, 32, 32, 77})));
+  ASSERT_EQ((lhs * rhs).ToMatrix(), lhs.ToMatrix() * rhs.ToMatrix());
+}
+
+TEST(MatrixStatic, EvaluatesAtCompileTime) {
+  constexpr S21StaticMatrix<double, 3, 3> kMtx({2, 0, 0, 0, 3, 0, 0, 0, 4});
+  static_assert(kMtx.Determinant() == 24);
+  static_assert(kMtx.InverseMatrix().At<2, 2>() == 0.25);
+  static_assert((kMtx * kMtx).At<1, 1>() == 9);
+  static_assert(kMtx.Transpose() == kMtx);
+  SUCCEED();
+}
+
+TEST(MatrixStatic, MatchesDynamicMatrix) {
+  ExpectMatchesDynamic<1>();
+  ExpectMatchesDynamic<2>();
+  ExpectMatchesDynamic<3>();
+  ExpectMatchesDynamic<4>();
+  ExpectMatchesDynamic<5>();
+  ExpectMatchesDynamic<8>();
+}
+
+TEST(MatrixStatic, SingularMatrices) {
+  S21StaticMatrix<double, 3, 3> singular({1, 2, 3, 4, 5, 6, 7, 8, 9});
+  ASSERT_NEAR(singular.Determinant(), 0, 1e-12);
+  ASSERT_THROW(singular.InverseMatrix(), std::logic_error);
+  ASSERT_EQ(singular.CalcComplements().ToMatrix(),
+            singular.ToMatrix().CalcComplements());
+
+  S21StaticMatrix<double, 6, 6> rank_deficient;
+  ASSERT_EQ(rank_deficient.Determinant(), 0);
+  ASSERT_THROW(rank_deficient.InverseMatrix(), std::logic_error);
+}
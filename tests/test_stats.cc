@@ -0,0 +1,125 @@
+#include <gtest/gtest.h>
+
+#include <sstream>
+#include <string>
+#include <utility>
+
+#include "s21_matrix_oop.h"
+
+// The instrumented checks only run in the build of this file alone with
+// S21_MATRIX_STATS (make test-stats); the regular runner checks that the
+// disabled layer records nothing.
+
+namespace {
+
+using s21::Operation;
+
+S21Matrix<double> MakeMatrix(size_t n) {
+  S21Matrix<double> mtx(n, n);
+  for (size_t r = 0; r < n; ++r) {
+    for (size_t c = 0; c < n; ++c) mtx(r, c) = r == c ? 4.0 : 1.0;
+  }
+  return mtx;
+}
+
+}  // namespace
+
+#ifndef S21_MATRIX_STATS
+
+TEST(MatrixStats, DisabledRecordsNothing) {
+  ASSERT_FALSE(s21::kStatsEnabled);
+  S21Matrix<double> a = MakeMatrix(20);
+  S21Matrix<double> b = a * a + a;
+  b.Determinant();
+  s21::StatsSnapshot stats = s21::GetStats();
+  for (const s21::OperationStats& op : stats.operations) {
+    ASSERT_EQ(op.calls, 0u);
+    ASSERT_EQ(op.allocations, 0u);
+  }
+  std::ostringstream os;
+  s21::WriteStatsJson(os, stats);
+  ASSERT_EQ(os.str(), "{}\n");
+}
+
+#else
+
+TEST(MatrixStats, CountsCallsElementsAndTime) {
+  s21::ResetStats();
+  S21Matrix<double> a = MakeMatrix(20);
+  S21Matrix<double> b = MakeMatrix(20);
+  a.SumMatrix(b);
+  a.SumMatrix(b);
+  a.MulMatrix(b);
+  a.Determinant();
+  s21::StatsSnapshot stats = s21::GetStats();
+
+  ASSERT_EQ(stats[Operation::kSum].calls, 2u);
+  ASSERT_EQ(stats[Operation::kSum].elements, 800u);
+  ASSERT_EQ(stats[Operation::kMulMatrix].calls, 1u);
+  ASSERT_EQ(stats[Operation::kMulMatrix].elements, 400u);
+  ASSERT_EQ(stats[Operation::kDeterminant].calls, 1u);
+  ASSERT_EQ(stats[Operation::kInverse].calls, 0u);
+  uint64_t timed = 0;
+  for (uint64_t bucket : stats[Operation::kSum].histogram) timed += bucket;
+  ASSERT_EQ(timed, 2u);
+  ASSERT_GT(stats[Operation::kMulMatrix].nanoseconds, 0u);
+
+  s21::ResetStats();
+  ASSERT_EQ(s21::GetStats()[Operation::kSum].calls, 0u);
+}
+
+TEST(MatrixStats, TracksAllocationsCopiesAndMoves) {
+  S21Matrix<double> a = MakeMatrix(20);
+  S21Matrix<double> b = MakeMatrix(20);
+  s21::ResetStats();
+
+  S21Matrix<double> copy(a);
+  S21Matrix<double> moved(std::move(copy));
+  S21Matrix<double> product = a * b;
+  s21::StatsSnapshot stats = s21::GetStats();
+
+  const s21::OperationStats& other = stats[Operation::kOther];
+  ASSERT_EQ(other.copies, 1u);
+  ASSERT_GE(other.moves, 1u);
+  ASSERT_EQ(other.allocations, 1u);
+  ASSERT_EQ(other.bytes_allocated, 20 * a.GetStride() * sizeof(double));
+  // the product's storage is allocated inside operator*
+  ASSERT_EQ(stats[Operation::kMulMatrix].allocations, 1u);
+
+  // an inline 2x2 matrix takes no heap storage
+  s21::ResetStats();
+  S21Matrix<double> small(2, 2);
+  ASSERT_EQ(s21::GetStats()[Operation::kOther].allocations, 0u);
+}
+
+TEST(MatrixStats, ExpressionsAndNestedOperations) {
+  S21Matrix<double> a = MakeMatrix(10);
+  S21Matrix<double> b = MakeMatrix(10);
+  s21::ResetStats();
+  S21Matrix<double> sum = a + b + a;
+  S21Matrix<double> inv = a.InverseMatrix();
+  s21::StatsSnapshot stats = s21::GetStats();
+
+  ASSERT_EQ(stats[Operation::kEvaluate].calls, 1u);
+  ASSERT_EQ(stats[Operation::kEvaluate].elements, 100u);
+  ASSERT_EQ(stats[Operation::kInverse].calls, 1u);
+  ASSERT_GE(stats[Operation::kInverse].nanoseconds,
+            stats[Operation::kDeterminant].nanoseconds);
+}
+
+TEST(MatrixStats, JsonDump) {
+  s21::ResetStats();
+  S21Matrix<double> a = MakeMatrix(3);
+  a.Transpose();
+  std::ostringstream os;
+  s21::WriteStatsJson(os, s21::GetStats());
+  std::string json = os.str();
+  ASSERT_NE(json.find("\"Transpose\": {\"calls\": 1, \"elements\": 9,"),
+            std::string::npos);
+  ASSERT_NE(json.find("\"histogram\": {\""), std::string::npos);
+  ASSERT_EQ(json.find("\"Determinant\""), std::string::npos);
+  ASSERT_EQ(json.front(), '{');
+  ASSERT_EQ(json.substr(json.size() - 4), "}\n}\n");
+}
+
+#endif  // S21_MATRIX_STATS
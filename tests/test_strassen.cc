@@ -0,0 +1,92 @@
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+
+#include "s21_matrix_strassen.h"
+
+namespace {
+
+template <typename T>
+S21Matrix<T> MakeMatrix(size_t rows, size_t cols, unsigned seed) {
+  S21Matrix<T> mtx(rows, cols);
+  for (size_t r = 0; r < rows; ++r) {
+    for (size_t c = 0; c < cols; ++c) {
+      seed = seed * 1103515245u + 12345u;
+      mtx(r, c) = static_cast<T>(static_cast<int>((seed >> 8) % 19) - 9);
+    }
+  }
+  return mtx;
+}
+
+double MaxDifference(const S21Matrix<double>& lhs,
+                     const S21Matrix<double>& rhs) {
+  double diff = 0.0;
+  for (size_t r = 0; r < lhs.GetRows(); ++r) {
+    for (size_t c = 0; c < lhs.GetCols(); ++c) {
+      diff = std::max(diff, std::fabs(lhs(r, c) - rhs(r, c)));
+    }
+  }
+  return diff;
+}
+
+}  // namespace
+
+TEST(MatrixStrassen, MatchesMulMatrix) {
+  // even, odd and rectangular shapes, several levels deep with cutoff 4
+  struct Shape {
+    size_t m, k, n;
+  };
+  for (Shape s : {Shape{16, 16, 16}, Shape{37, 29, 41}, Shape{64, 9, 50},
+                  Shape{5, 70, 33}, Shape{1, 20, 20}}) {
+    S21Matrix<double> a = MakeMatrix<double>(s.m, s.k, 1);
+    S21Matrix<double> b = MakeMatrix<double>(s.k, s.n, 2);
+    S21Matrix<double> res = s21::StrassenMulMatrix<double>(a, b, 4);
+    ASSERT_EQ(res.GetRows(), s.m);
+    ASSERT_EQ(res.GetCols(), s.n);
+    ASSERT_LT(MaxDifference(res, a * b), 1e-9);
+  }
+}
+
+TEST(MatrixStrassen, IntegersAreExact) {
+  S21Matrix<std::int64_t> a = MakeMatrix<std::int64_t>(45, 38, 3);
+  S21Matrix<std::int64_t> b = MakeMatrix<std::int64_t>(38, 51, 4);
+  ASSERT_EQ(s21::StrassenMulMatrix<std::int64_t>(a, b, 3), a * b);
+}
+
+TEST(MatrixStrassen, SmallProductsUseTheRegularKernel) {
+  S21Matrix<double> a = MakeMatrix<double>(20, 30, 5);
+  S21Matrix<double> b = MakeMatrix<double>(30, 10, 6);
+  ASSERT_EQ(s21::StrassenMulMatrix<double>(a, b), a * b);
+  ASSERT_EQ(s21::StrassenMulMatrix<double>(a, b, 0), a * b);
+
+  S21Matrix<double> empty;
+  ASSERT_EQ(s21::StrassenMulMatrix<double>(empty, empty), empty);
+  ASSERT_THROW(s21::StrassenMulMatrix<double>(a, a), std::logic_error);
+}
+
+TEST(MatrixStrassen, ViewsAndResource) {
+  std::pmr::monotonic_buffer_resource pool;
+  S21Matrix<double> a(MakeMatrix<double>(40, 40, 7), &pool);
+  S21Matrix<double> b = MakeMatrix<double>(40, 40, 8);
+  auto lhs = a.Block(3, 5, 30, 22);
+  auto rhs = b.Block(1, 0, 22, 33);
+  S21Matrix<double> res = s21::StrassenMulMatrix<double>(lhs, rhs, 4);
+  ASSERT_EQ(res.GetResource(), &pool);
+  S21Matrix<double> expected = S21Matrix<double>(lhs) * S21Matrix<double>(rhs);
+  ASSERT_LT(MaxDifference(res, expected), 1e-9);
+}
+
+TEST(MatrixStrassen, ResultsDoNotDependOnThreads) {
+  S21Matrix<double> a = MakeMatrix<double>(130, 121, 9);
+  S21Matrix<double> b = MakeMatrix<double>(121, 117, 10);
+  for (size_t r = 0; r < a.GetRows(); ++r) a(r, r % 121) += 0.125;
+  S21Matrix<double> serial = s21::StrassenMulMatrix<double>(a, b, 16);
+  s21::ScopedExecutionPolicy policy({4, 0});
+  S21Matrix<double> parallel = s21::StrassenMulMatrix<double>(a, b, 16);
+  for (size_t r = 0; r < parallel.GetRows(); ++r) {
+    ASSERT_TRUE(std::equal(parallel.RowData(r), parallel.RowData(r) + 117,
+                           serial.RowData(r)));
+  }
+}
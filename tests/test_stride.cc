@@ -0,0 +1,125 @@
+#include <gtest/gtest.h>
+
+#include <cstdint>
+
+#include "s21_matrix_oop.h"
+
+namespace {
+
+// fills (r, c) with a value that is unique and exactly representable
+template <typename T>
+S21Matrix<T> MakeIndexed(size_t rows, size_t cols) {
+  S21Matrix<T> mtx(rows, cols);
+  for (size_t r = 0; r < rows; ++r) {
+    for (size_t c = 0; c < cols; ++c) mtx(r, c) = r * 1000 + c;
+  }
+  return mtx;
+}
+
+bool IsCacheLineAligned(const void* ptr) {
+  return reinterpret_cast<std::uintptr_t>(ptr) % 64 == 0;
+}
+
+}  // namespace
+
+TEST(MatrixStride, NarrowRowsStayDense) {
+  S21Matrix<double> mtx(3, 7);
+  EXPECT_EQ(mtx.GetStride(), 7u);
+  S21Matrix<int> ints(40, 15);
+  EXPECT_EQ(ints.GetStride(), 15u);
+}
+
+TEST(MatrixStride, WideRowsArePaddedToCacheLines) {
+  S21Matrix<double> mtx(20, 13);
+  EXPECT_EQ(mtx.GetStride(), 16u);
+  EXPECT_TRUE(IsCacheLineAligned(mtx.Data()));
+  for (size_t r = 0; r < mtx.GetRows(); ++r) {
+    EXPECT_TRUE(IsCacheLineAligned(mtx.Data() + r * mtx.GetStride()));
+  }
+  S21Matrix<double> exact(20, 16);
+  EXPECT_EQ(exact.GetStride(), 16u);
+}
+
+TEST(MatrixStride, PageSizedRowsGetAnExtraLine) {
+  S21Matrix<double> mtx(4, 512);
+  EXPECT_EQ(mtx.GetStride(), 520u);
+  S21Matrix<float> floats(4, 1024);
+  EXPECT_EQ(floats.GetStride(), 1040u);
+}
+
+TEST(MatrixStride, DataFollowsTheStride) {
+  auto mtx = MakeIndexed<double>(9, 21);
+  const double* data = mtx.Data();
+  for (size_t r = 0; r < mtx.GetRows(); ++r) {
+    for (size_t c = 0; c < mtx.GetCols(); ++c) {
+      EXPECT_EQ(data[r * mtx.GetStride() + c], mtx(r, c));
+    }
+  }
+  mtx.Data()[2 * mtx.GetStride() + 5] = -1.0;
+  EXPECT_EQ(mtx(2, 5), -1.0);
+}
+
+TEST(MatrixStride, ElementwiseOperationsSkipThePadding) {
+  auto lhs = MakeIndexed<double>(33, 45);
+  auto rhs = MakeIndexed<double>(33, 45);
+  ASSERT_NE(lhs.GetStride(), lhs.GetCols());
+  lhs.Data()[lhs.GetCols()] = 12345.0;  // padding of row 0
+  EXPECT_TRUE(lhs == rhs);
+  lhs += rhs;
+  lhs *= 0.5;
+  EXPECT_TRUE(lhs == rhs);
+  lhs -= rhs;
+  EXPECT_TRUE(lhs == S21Matrix<double>(33, 45));
+  EXPECT_EQ(lhs.Data()[lhs.GetCols()], 12345.0);
+}
+
+TEST(MatrixStride, PaddedProductsAndTransposes) {
+  auto lhs = MakeIndexed<double>(19, 27);
+  auto rhs = MakeIndexed<double>(27, 11);
+  S21Matrix<double> expected(19, 11);
+  for (size_t r = 0; r < 19; ++r) {
+    for (size_t c = 0; c < 11; ++c) {
+      double sum = 0.0;
+      for (size_t k = 0; k < 27; ++k) sum += lhs(r, k) * rhs(k, c);
+      expected(r, c) = sum;
+    }
+  }
+  EXPECT_TRUE(lhs * rhs == expected);
+
+  auto transposed = lhs.Transpose();
+  for (size_t r = 0; r < 19; ++r) {
+    for (size_t c = 0; c < 27; ++c) EXPECT_EQ(transposed(c, r), lhs(r, c));
+  }
+  auto square = MakeIndexed<double>(30, 30);
+  auto copy = square;
+  square.TransposeInPlace();
+  EXPECT_TRUE(square == copy.Transpose());
+}
+
+TEST(MatrixStride, PaddedInverse) {
+  S21Matrix<double> mtx(12, 12);
+  for (size_t r = 0; r < 12; ++r) {
+    for (size_t c = 0; c < 12; ++c) mtx(r, c) = (r == c) ? 12 : (r + 2 * c) % 3;
+  }
+  ASSERT_NE(mtx.GetStride(), mtx.GetCols());
+  auto product = mtx * mtx.InverseMatrix();
+  for (size_t r = 0; r < 12; ++r) {
+    for (size_t c = 0; c < 12; ++c) {
+      EXPECT_NEAR(product(r, c), r == c ? 1.0 : 0.0, 1e-12);
+    }
+  }
+}
+
+TEST(MatrixStride, ResizingKeepsElements) {
+  auto mtx = MakeIndexed<double>(10, 6);
+  mtx.SetCols(14);
+  EXPECT_EQ(mtx.GetStride(), 16u);
+  for (size_t r = 0; r < 10; ++r) {
+    for (size_t c = 0; c < 14; ++c) {
+      EXPECT_EQ(mtx(r, c), c < 6 ? r * 1000.0 + c : 0.0);
+    }
+  }
+  mtx.SetCols(5);
+  EXPECT_EQ(mtx.GetStride(), 5u);
+  EXPECT_EQ(mtx(9, 4), 9004.0);
+}
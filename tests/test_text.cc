@@ -0,0 +1,222 @@
+#include <gtest/gtest.h>
+
+#include <cfloat>
+#include <cstdint>
+#include <filesystem>
+#include <limits>
+#include <sstream>
+#include <string>
+
+#include "s21_matrix_text.h"
+
+namespace {
+
+S21Matrix<double> MakeAwkward(size_t rows, size_t cols) {
+  S21Matrix<double> mtx(rows, cols);
+  for (size_t r = 0; r < rows; ++r) {
+    for (size_t c = 0; c < cols; ++c) mtx(r, c) = (r + 1.0) / (c + 3.0) - c;
+  }
+  return mtx;
+}
+
+// bit-exact comparison, unlike EqMatrix
+template <typename T>
+void ExpectIdentical(const S21Matrix<T>& lhs, const S21Matrix<T>& rhs) {
+  ASSERT_EQ(lhs.GetRows(), rhs.GetRows());
+  ASSERT_EQ(lhs.GetCols(), rhs.GetCols());
+  for (size_t r = 0; r < lhs.GetRows(); ++r) {
+    for (size_t c = 0; c < lhs.GetCols(); ++c) {
+      ASSERT_EQ(lhs(r, c), rhs(r, c)) << "at (" << r << ", " << c << ")";
+    }
+  }
+}
+
+S21Matrix<double> CsvRoundTrip(const S21Matrix<double>& mtx, char delim) {
+  std::stringstream ss;
+  s21::WriteCsv(ss, mtx, delim);
+  return s21::ReadCsv<double>(ss, delim);
+}
+
+S21Matrix<double> ParseCsv(const std::string& text) {
+  std::stringstream ss(text);
+  return s21::ReadCsv<double>(ss);
+}
+
+S21Matrix<double> ParseMarket(const std::string& text) {
+  std::stringstream ss(text);
+  return s21::ReadMatrixMarket<double>(ss);
+}
+
+}  // namespace
+
+TEST(MatrixText, CsvRoundTripIsExact) {
+  auto mtx = MakeAwkward(17, 23);
+  mtx(0, 0) = DBL_MIN;
+  mtx(0, 1) = DBL_MAX;
+  mtx(0, 2) = -DBL_TRUE_MIN;
+  mtx(0, 3) = 0.1;
+  ExpectIdentical(CsvRoundTrip(mtx, ','), mtx);
+  ExpectIdentical(CsvRoundTrip(mtx, ';'), mtx);
+  // blanks that are the delimiter separate fields
+  ExpectIdentical(CsvRoundTrip(mtx, '\t'), mtx);
+  ExpectIdentical(CsvRoundTrip(mtx, ' '), mtx);
+  // rows are cut by the read blocks
+  auto large = MakeAwkward(3000, 40);
+  ExpectIdentical(CsvRoundTrip(large, ','), large);
+  ExpectIdentical(CsvRoundTrip(S21Matrix<double>(), ','), S21Matrix<double>());
+}
+
+TEST(MatrixText, CsvUsesShortestForms) {
+  S21Matrix<double> mtx(2, 3);
+  mtx(0, 0) = 0.1;
+  mtx(0, 1) = -2.5;
+  mtx(0, 2) = 1e300;
+  mtx(1, 1) = 3.0;
+  std::stringstream ss;
+  s21::WriteCsv(ss, mtx);
+  EXPECT_EQ(ss.str(), "0.1,-2.5,1e+300\n0,3,0\n");
+}
+
+TEST(MatrixText, CsvIntegersAndViews) {
+  S21Matrix<std::int64_t> ints(2, 2);
+  ints(0, 0) = std::numeric_limits<std::int64_t>::min();
+  ints(1, 1) = std::numeric_limits<std::int64_t>::max();
+  std::stringstream ss;
+  s21::WriteCsv(ss, ints);
+  ExpectIdentical(s21::ReadCsv<std::int64_t>(ss), ints);
+
+  auto mtx = MakeAwkward(10, 10);
+  std::stringstream block;
+  s21::WriteCsv(block, mtx.Block(2, 3, 4, 5));
+  EXPECT_TRUE(s21::ReadCsv<double>(block) == mtx.Block(2, 3, 4, 5));
+}
+
+TEST(MatrixText, CsvToleratesBlanksAndCrlf) {
+  auto mtx = ParseCsv("\n 1 , +2,3\r\n\n4,5 ,\t6\r\n\n");
+  ASSERT_EQ(mtx.GetRows(), 2u);
+  ASSERT_EQ(mtx.GetCols(), 3u);
+  EXPECT_EQ(mtx(0, 1), 2.0);
+  EXPECT_EQ(mtx(1, 2), 6.0);
+  auto last = ParseCsv("1,2\n3,4");
+  EXPECT_EQ(last(1, 1), 4.0);
+}
+
+TEST(MatrixText, CsvBlankDelimitersTakeRunsOfBlanks) {
+  auto parse = [](const std::string& text, char delim) {
+    std::stringstream ss(text);
+    return s21::ReadCsv<double>(ss, delim);
+  };
+  S21Matrix<double> expected(2, 2);
+  expected(0, 0) = 1;
+  expected(0, 1) = 2;
+  expected(1, 0) = 3;
+  expected(1, 1) = 4;
+  for (const char* text : {"1  2\n3 4\n", "1 2 \n3 4\n", " 1 2\n 3\t4\r\n",
+                           "\t1 \t 2\t\n3 4\n"}) {
+    ExpectIdentical(parse(text, ' '), expected);
+    ExpectIdentical(parse(text, '\t'), expected);
+  }
+  EXPECT_THROW(parse("1 2\n3\n", ' '), std::runtime_error);
+  EXPECT_THROW(parse("1 2\n3 4 5\n", ' '), std::runtime_error);
+  EXPECT_THROW(parse("1 2\n3 4x\n", ' '), std::runtime_error);
+}
+
+TEST(MatrixText, CsvErrorsNameTheLine) {
+  try {
+    ParseCsv("1,2\n3,x\n");
+    FAIL();
+  } catch (const std::runtime_error& e) {
+    EXPECT_STREQ(e.what(), "line 2: invalid number 'x'");
+  }
+  EXPECT_THROW(ParseCsv("1,2\n3\n"), std::runtime_error);
+  EXPECT_THROW(ParseCsv("1,2\n3,4,5\n"), std::runtime_error);
+  EXPECT_THROW(ParseCsv("1,2\n3,4 5\n"), std::runtime_error);
+  EXPECT_THROW(ParseCsv("1e999\n"), std::runtime_error);
+  std::stringstream ss("300\n");
+  EXPECT_THROW(s21::ReadCsv<std::int8_t>(ss), std::runtime_error);
+  EXPECT_THROW(ParseCsv("1,2,\n"), std::runtime_error);
+}
+
+TEST(MatrixText, MatrixMarketArrayRoundTrip) {
+  auto mtx = MakeAwkward(9, 4);
+  std::stringstream ss;
+  s21::WriteMatrixMarket(ss, mtx);
+  EXPECT_EQ(ss.str().rfind("%%MatrixMarket matrix array real general\n9 4\n",
+                           0),
+            0u);
+  ExpectIdentical(s21::ReadMatrixMarket<double>(ss), mtx);
+
+  S21Matrix<int> ints(2, 2);
+  ints(1, 0) = -7;
+  std::stringstream is;
+  s21::WriteMatrixMarket(is, ints);
+  EXPECT_EQ(is.str(),
+            "%%MatrixMarket matrix array integer general\n2 2\n0\n-7\n0\n0\n");
+}
+
+TEST(MatrixText, MatrixMarketCoordinate) {
+  auto mtx = ParseMarket(
+      "%%MatrixMarket matrix coordinate real general\n"
+      "% a comment\n"
+      "%\n"
+      "3 4 3\n"
+      "1 1 1.5\n"
+      "3 4 -2\n"
+      "2 3 1e-3\n");
+  ASSERT_EQ(mtx.GetRows(), 3u);
+  ASSERT_EQ(mtx.GetCols(), 4u);
+  EXPECT_EQ(mtx(0, 0), 1.5);
+  EXPECT_EQ(mtx(2, 3), -2.0);
+  EXPECT_EQ(mtx(1, 2), 1e-3);
+  EXPECT_EQ(mtx(0, 1), 0.0);
+}
+
+TEST(MatrixText, MatrixMarketSymmetry) {
+  auto sym = ParseMarket(
+      "%%MatrixMarket matrix coordinate pattern symmetric\n"
+      "3 3 2\n2 1\n3 3\n");
+  EXPECT_EQ(sym(0, 1), 1.0);
+  EXPECT_EQ(sym(1, 0), 1.0);
+  EXPECT_EQ(sym(2, 2), 1.0);
+  auto skew = ParseMarket(
+      "%%MatrixMarket matrix array real skew-symmetric\n"
+      "3 3\n1\n2\n3\n");
+  EXPECT_EQ(skew(1, 0), 1.0);
+  EXPECT_EQ(skew(0, 1), -1.0);
+  EXPECT_EQ(skew(2, 1), 3.0);
+  EXPECT_EQ(skew(1, 1), 0.0);
+}
+
+TEST(MatrixText, MatrixMarketErrors) {
+  EXPECT_THROW(ParseMarket("3 3\n"), std::runtime_error);
+  EXPECT_THROW(ParseMarket("%%MatrixMarket matrix array complex general\n"),
+               std::runtime_error);
+  EXPECT_THROW(ParseMarket("%%MatrixMarket matrix coordinate real general\n"
+                           "2 2 1\n3 1 1\n"),
+               std::runtime_error);
+  EXPECT_THROW(ParseMarket("%%MatrixMarket matrix array real general\n"
+                           "2 2\n1\n2\n3\n"),
+               std::runtime_error);
+  // 2^59 + 1 rows of 32 doubles would wrap to 32 elements
+  try {
+    ParseMarket("%%MatrixMarket matrix coordinate real general\n"
+                "576460752303423489 32 2\n3 1 3.0\n");
+    FAIL();
+  } catch (const std::runtime_error& e) {
+    EXPECT_STREQ(e.what(), "line 2: matrix size too large");
+  }
+}
+
+TEST(MatrixText, Files) {
+  auto dir = std::filesystem::temp_directory_path();
+  std::string csv = (dir / "s21_matrix_test.csv").string();
+  std::string mtx_path = (dir / "s21_matrix_test.mtx").string();
+  auto mtx = MakeAwkward(30, 20);
+  s21::SaveCsv(csv, mtx);
+  s21::SaveMatrixMarket(mtx_path, mtx);
+  ExpectIdentical(s21::LoadCsv<double>(csv), mtx);
+  ExpectIdentical(s21::LoadMatrixMarket<double>(mtx_path), mtx);
+  std::filesystem::remove(csv);
+  std::filesystem::remove(mtx_path);
+  EXPECT_THROW(s21::LoadCsv<double>(csv), std::runtime_error);
+}
@@ -0,0 +1,110 @@
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <cstring>
+#include <vector>
+
+#include "s21_matrix_oop.h"
+
+namespace {
+
+S21Matrix<double> MakeNoise(size_t rows, size_t cols, unsigned seed) {
+  S21Matrix<double> mtx(rows, cols);
+  for (size_t r = 0; r < rows; ++r) {
+    for (size_t c = 0; c < cols; ++c) {
+      seed = seed * 1103515245u + 12345u;
+      mtx(r, c) = static_cast<double>((seed >> 8) % 10007) / 1013.0 - 5.0;
+    }
+  }
+  return mtx;
+}
+
+bool BitwiseEqual(const S21Matrix<double>& lhs, const S21Matrix<double>& rhs) {
+  if (!lhs.IsEqualSize(rhs)) return false;
+  for (size_t r = 0; r < lhs.GetRows(); ++r) {
+    for (size_t c = 0; c < lhs.GetCols(); ++c) {
+      if (std::memcmp(&lhs(r, c), &rhs(r, c), sizeof(double))) return false;
+    }
+  }
+  return true;
+}
+
+}  // namespace
+
+TEST(MatrixThreadPool, ParallelForVisitsEveryIndexOnce) {
+  s21::ThreadPool pool(3);
+  std::vector<std::atomic<int>> visits(1000);
+  pool.ParallelFor(visits.size(), 7, [&](size_t begin, size_t end) {
+    for (size_t i = begin; i < end; ++i) ++visits[i];
+  });
+  for (const auto& count : visits) ASSERT_EQ(count.load(), 1);
+}
+
+TEST(MatrixThreadPool, ExceptionsReachTheCaller) {
+  s21::ThreadPool pool(2);
+  ASSERT_THROW(pool.ParallelFor(100, 1,
+                                [](size_t begin, size_t) {
+                                  if (begin == 42) {
+                                    throw std::logic_error("chunk failed");
+                                  }
+                                }),
+               std::logic_error);
+}
+
+TEST(MatrixThreadPool, NestedParallelForDoesNotDeadlock) {
+  s21::ThreadPool pool(2);
+  std::atomic<size_t> total{0};
+  pool.ParallelFor(8, 1, [&](size_t, size_t) {
+    pool.ParallelFor(100, 10, [&](size_t begin, size_t end) {
+      total += end - begin;
+    });
+  });
+  ASSERT_EQ(total.load(), 800u);
+}
+
+TEST(MatrixThreadPool, ScopedPolicyOverridesAndRestores) {
+  s21::ExecutionPolicy global = s21::GetExecutionPolicy();
+  {
+    s21::ScopedExecutionPolicy scope({4, 0});
+    ASSERT_EQ(s21::GetExecutionPolicy().threads, 4u);
+    ASSERT_EQ(s21::GetExecutionPolicy().serial_threshold, 0u);
+  }
+  ASSERT_EQ(s21::GetExecutionPolicy().threads, global.threads);
+}
+
+TEST(MatrixThreadPool, ResultsDoNotDependOnThreadCount) {
+  S21Matrix<double> lhs = MakeNoise(150, 140, 1);
+  S21Matrix<double> rhs = MakeNoise(140, 130, 2);
+  S21Matrix<double> same = MakeNoise(150, 140, 3);
+  S21Matrix<double> square = MakeNoise(7, 7, 4);
+
+  S21Matrix<double> product = lhs * rhs;
+  S21Matrix<double> sum = lhs + same;
+  S21Matrix<double> diff = lhs - same;
+  S21Matrix<double> scaled = lhs * 1.75;
+  S21Matrix<double> transposed = lhs.Transpose();
+  S21Matrix<double> in_place = lhs * MakeNoise(140, 150, 5);
+  S21Matrix<double> in_place_ans = in_place.Transpose();
+  S21Matrix<double> complements = square.CalcComplements();
+
+  for (size_t threads : {2, 3, 8}) {
+    s21::ScopedExecutionPolicy scope({threads, 0});
+    SCOPED_TRACE(threads);
+    ASSERT_TRUE(BitwiseEqual(lhs * rhs, product));
+    ASSERT_TRUE(BitwiseEqual(lhs + same, sum));
+    ASSERT_TRUE(BitwiseEqual(lhs - same, diff));
+    ASSERT_TRUE(BitwiseEqual(lhs * 1.75, scaled));
+    ASSERT_TRUE(BitwiseEqual(lhs.Transpose(), transposed));
+    S21Matrix<double> copy = in_place;
+    copy.TransposeInPlace();
+    ASSERT_TRUE(BitwiseEqual(copy, in_place_ans));
+    ASSERT_TRUE(BitwiseEqual(square.CalcComplements(), complements));
+  }
+}
+
+TEST(MatrixThreadPool, ErrorsSurviveParallelExecution) {
+  s21::ScopedExecutionPolicy scope({4, 0});
+  ASSERT_THROW(S21Matrix<double>(3, 3) + S21Matrix<double>(3, 4),
+               std::logic_error);
+  ASSERT_THROW(S21Matrix<double>(2, 3).CalcComplements(), std::logic_error);
+}
@@ -0,0 +1,161 @@
+#include <gtest/gtest.h>
+
+#include <cmath>
+#include <cstdint>
+#include <limits>
+
+#include "s21_matrix_oop.h"
+
+namespace {
+
+using s21::AbsoluteTolerance;
+using s21::RelativeTolerance;
+using s21::UlpTolerance;
+using s21::simd::Isa;
+
+constexpr Isa kAllIsas[] = {Isa::kScalar, Isa::kSse2, Isa::kAvx2,
+                            Isa::kAvx512};
+
+// restores the detected instruction set when the test ends
+class IsaGuard {
+ public:
+  IsaGuard() : _saved(s21::simd::ActiveIsa()) {}
+  ~IsaGuard() { s21::simd::SetActiveIsa(_saved); }
+
+ private:
+  Isa _saved;
+};
+
+template <typename T>
+S21Matrix<T> MakeMatrix(size_t rows, size_t cols) {
+  S21Matrix<T> mtx(rows, cols);
+  for (size_t r = 0; r < rows; ++r) {
+    for (size_t c = 0; c < cols; ++c) {
+      mtx(r, c) = static_cast<T>((r * 7 + c * 3) % 23) + T(1) / T(4);
+    }
+  }
+  return mtx;
+}
+
+}  // namespace
+
+TEST(MatrixTolerance, NoToleranceIsStoredInTheMatrix) {
+  // rows, cols, stride, capacity, the storage and resource pointers and
+  // the inline elements
+  EXPECT_EQ(sizeof(S21Matrix<double>),
+            4 * sizeof(size_t) + 2 * sizeof(void*) + 128);
+  EXPECT_EQ(sizeof(S21Matrix<float>), sizeof(S21Matrix<double>));
+}
+
+TEST(MatrixTolerance, Absolute) {
+  S21Matrix<double> lhs = MakeMatrix<double>(9, 70);
+  S21Matrix<double> rhs = lhs;
+  rhs(8, 69) += 1e-3;
+  ASSERT_FALSE(lhs.EqMatrix(rhs));
+  ASSERT_TRUE(lhs.EqMatrix(rhs, AbsoluteTolerance{1e-3 * 1.01}));
+  ASSERT_FALSE(lhs.EqMatrix(rhs, AbsoluteTolerance{1e-4}));
+
+  // the default is the epsilon of the element type
+  S21Matrix<float> flhs(2, 40, 1.0f);
+  S21Matrix<float> frhs = flhs;
+  frhs(1, 39) = std::nextafter(1.0f, 2.0f);
+  ASSERT_TRUE(flhs.EqMatrix(frhs));
+  ASSERT_TRUE(flhs == frhs);
+  ASSERT_TRUE(flhs.View() == frhs.View());
+  frhs(1, 39) = std::nextafter(frhs(1, 39), 2.0f);
+  ASSERT_FALSE(flhs.EqMatrix(frhs));
+
+  // integers compare by their exact difference, unsigned ones included
+  S21Matrix<unsigned> ulhs(3, 50, 7u);
+  S21Matrix<unsigned> urhs = ulhs;
+  urhs(2, 49) = 9u;
+  ASSERT_FALSE(ulhs.EqMatrix(urhs));
+  ASSERT_FALSE(ulhs.EqMatrix(urhs, AbsoluteTolerance{1.5}));
+  ASSERT_TRUE(ulhs.EqMatrix(urhs, AbsoluteTolerance{2.0}));
+  ASSERT_TRUE(urhs.EqMatrix(ulhs, AbsoluteTolerance{2.0}));
+}
+
+TEST(MatrixTolerance, Relative) {
+  S21Matrix<float> lhs = MakeMatrix<float>(5, 40);
+  S21Matrix<float> rhs = lhs;
+  lhs(1, 1) = 1e6f;
+  rhs(1, 1) = 1e6f + 64.0f;
+  ASSERT_TRUE(lhs.EqMatrix(rhs, RelativeTolerance{1e-4}));
+  ASSERT_FALSE(lhs.EqMatrix(rhs, RelativeTolerance{1e-5}));
+  ASSERT_FALSE(lhs.EqMatrix(rhs));
+
+  // near zero the absolute floor decides
+  lhs(1, 1) = 0.0f;
+  rhs(1, 1) = 1e-7f;
+  ASSERT_FALSE(lhs.EqMatrix(rhs, RelativeTolerance{1e-3}));
+  ASSERT_TRUE(lhs.EqMatrix(rhs, RelativeTolerance{1e-3, 1e-6}));
+
+  rhs(1, 1) = std::numeric_limits<float>::quiet_NaN();
+  ASSERT_FALSE(rhs.EqMatrix(rhs, RelativeTolerance{}));
+  rhs(1, 1) = std::numeric_limits<float>::infinity();
+  ASSERT_TRUE(rhs.EqMatrix(rhs, RelativeTolerance{}));
+}
+
+TEST(MatrixTolerance, Ulp) {
+  S21Matrix<double> lhs = MakeMatrix<double>(4, 33);
+  S21Matrix<double> rhs = lhs;
+  double x = rhs(3, 32);
+  rhs(3, 32) = std::nextafter(std::nextafter(x, 100.0), 100.0);
+  ASSERT_TRUE(lhs.EqMatrix(rhs, UlpTolerance{2}));
+  ASSERT_FALSE(lhs.EqMatrix(rhs, UlpTolerance{1}));
+
+  // across zero: -0 and +0 are equal, the smallest subnormals 2 apart
+  S21Matrix<float> zeros(1, 2, 0.0f);
+  S21Matrix<float> around(1, 2, -0.0f);
+  ASSERT_TRUE(zeros.EqMatrix(around, UlpTolerance{0}));
+  zeros(0, 0) = std::numeric_limits<float>::denorm_min();
+  around(0, 0) = -std::numeric_limits<float>::denorm_min();
+  ASSERT_TRUE(zeros.EqMatrix(around, UlpTolerance{2}));
+  ASSERT_FALSE(zeros.EqMatrix(around, UlpTolerance{1}));
+
+  S21Matrix<std::int64_t> ints(2, 2, std::numeric_limits<std::int64_t>::min());
+  S21Matrix<std::int64_t> other(2, 2, std::numeric_limits<std::int64_t>::max());
+  ASSERT_FALSE(ints.EqMatrix(other, UlpTolerance{1000}));
+  other(0, 0) = ints(0, 0) + 3;
+  other(0, 1) = other(1, 0) = other(1, 1) = ints(0, 0);
+  ASSERT_TRUE(ints.EqMatrix(other, UlpTolerance{3}));
+
+  S21Matrix<long double> wide(2, 2, 1.0L);
+  S21Matrix<long double> next = wide;
+  next(1, 1) = std::nextafter(1.0L, 2.0L);
+  ASSERT_TRUE(wide.EqMatrix(next, UlpTolerance{1}));
+  ASSERT_FALSE(wide.EqMatrix(next, UlpTolerance{0}));
+}
+
+TEST(MatrixTolerance, ViewsAndStrides) {
+  S21Matrix<double> big = MakeMatrix<double>(20, 20);
+  S21Matrix<double> block = big.Block(2, 3, 10, 12).ToMatrix();
+  ASSERT_TRUE(block.EqMatrix(big.Block(2, 3, 10, 12), UlpTolerance{0}));
+  block(9, 11) += 1.0;
+  ASSERT_FALSE(big.Block(2, 3, 10, 12).EqMatrix(block.View(),
+                                                RelativeTolerance{1e-3}));
+  ASSERT_FALSE(block.EqMatrix(big.Block(2, 3, 10, 12), UlpTolerance{8}));
+  ASSERT_FALSE(block.EqMatrix(big, UlpTolerance{8}));
+}
+
+TEST(MatrixTolerance, EveryPathAndThreadCountAgrees) {
+  IsaGuard guard;
+  S21Matrix<float> lhs = MakeMatrix<float>(300, 257);
+  S21Matrix<float> rhs = lhs;
+  for (Isa isa : kAllIsas) {
+    if (!s21::simd::IsSupported(isa)) continue;
+    SCOPED_TRACE(s21::simd::IsaName(isa));
+    s21::simd::SetActiveIsa(isa);
+    for (size_t threads : {1, 4}) {
+      s21::ScopedExecutionPolicy policy({threads, 0});
+      rhs(150, 100) = lhs(150, 100);
+      ASSERT_TRUE(lhs.EqMatrix(rhs, UlpTolerance{0}));
+      ASSERT_TRUE(lhs.EqMatrix(rhs, RelativeTolerance{0.0}));
+      rhs(150, 100) = std::nextafter(lhs(150, 100), 100.0f);
+      ASSERT_TRUE(lhs.EqMatrix(rhs, UlpTolerance{1}));
+      ASSERT_FALSE(lhs.EqMatrix(rhs, UlpTolerance{0}));
+      ASSERT_FALSE(lhs.EqMatrix(rhs, RelativeTolerance{1e-9}));
+      ASSERT_FALSE(lhs == rhs);
+    }
+  }
+}
@@ -0,0 +1,150 @@
+#include <gtest/gtest.h>
+
+#include <sstream>
+#include <type_traits>
+#include <vector>
+
+#include "s21_matrix_oop.h"
+
+namespace {
+
+S21Matrix<double> MakeFilled(size_t rows, size_t cols, double start) {
+  S21Matrix<double> mtx(rows, cols);
+  for (size_t r = 0; r < rows; ++r) {
+    for (size_t c = 0; c < cols; ++c) {
+      mtx(r, c) = start + static_cast<double>(r * cols + c);
+    }
+  }
+  return mtx;
+}
+
+// the block copied element by element, for reference
+S21Matrix<double> CopyBlock(const S21Matrix<double>& mtx, size_t row,
+                            size_t col, size_t rows, size_t cols) {
+  S21Matrix<double> block(rows, cols);
+  for (size_t r = 0; r < rows; ++r) {
+    for (size_t c = 0; c < cols; ++c) block(r, c) = mtx(row + r, col + c);
+  }
+  return block;
+}
+
+}  // namespace
+
+TEST(MatrixView, BlocksShareStorage) {
+  auto mtx = MakeFilled(6, 20, 0.0);
+  auto block = mtx.Block(1, 2, 3, 4);
+  ASSERT_EQ(block.GetRows(), 3u);
+  ASSERT_EQ(block.GetCols(), 4u);
+  ASSERT_EQ(block.GetStride(), mtx.GetStride());
+  ASSERT_EQ(block.Data(), &mtx(1, 2));
+  EXPECT_EQ(block(2, 3), mtx(3, 5));
+  block(0, 0) = -1.0;
+  EXPECT_EQ(mtx(1, 2), -1.0);
+  EXPECT_EQ(block.Block(1, 1, 2, 2)(0, 0), mtx(2, 3));
+}
+
+TEST(MatrixView, RowsAndColumns) {
+  auto mtx = MakeFilled(5, 7, 1.0);
+  auto row = mtx.Row(3);
+  auto col = mtx.Col(4);
+  ASSERT_EQ(row.GetRows(), 1u);
+  ASSERT_EQ(col.GetCols(), 1u);
+  for (size_t c = 0; c < 7; ++c) EXPECT_EQ(row(0, c), mtx(3, c));
+  for (size_t r = 0; r < 5; ++r) EXPECT_EQ(col(r, 0), mtx(r, 4));
+  col *= 2.0;
+  EXPECT_EQ(mtx(0, 4), 10.0);
+  EXPECT_EQ(mtx(0, 3), 4.0);
+}
+
+TEST(MatrixView, OutOfRangeSlices) {
+  S21Matrix<double> mtx(4, 5);
+  EXPECT_THROW(mtx.Block(2, 0, 3, 1), std::out_of_range);
+  EXPECT_THROW(mtx.Block(0, 4, 1, 2), std::out_of_range);
+  EXPECT_THROW(mtx.Row(4), std::out_of_range);
+  EXPECT_THROW(mtx.Col(5), std::out_of_range);
+  EXPECT_THROW(mtx.View()(0, 5), std::out_of_range);
+  EXPECT_NO_THROW(mtx.Block(4, 5, 0, 0));
+}
+
+TEST(MatrixView, ConstMatricesGiveReadOnlyViews) {
+  const auto mtx = MakeFilled(3, 3, 0.0);
+  auto view = mtx.View();
+  ASSERT_TRUE((std::is_same_v<decltype(view), S21MatrixView<const double>>));
+  ASSERT_TRUE((std::is_same_v<decltype(view(0, 0)), const double&>));
+  S21Matrix<double> other(2, 2);
+  S21MatrixView<const double> converted = other.View();
+  EXPECT_EQ(converted.GetRows(), 2u);
+}
+
+TEST(MatrixView, ElementwiseOperationsWriteThrough) {
+  auto mtx = MakeFilled(8, 8, 0.0);
+  auto other = MakeFilled(8, 8, 100.0);
+  auto expected = mtx;
+  for (size_t r = 2; r < 5; ++r) {
+    for (size_t c = 1; c < 7; ++c) expected(r, c) += other(r, c);
+  }
+  mtx.Block(2, 1, 3, 6) += other.Block(2, 1, 3, 6);
+  EXPECT_TRUE(mtx == expected);
+  mtx.Block(2, 1, 3, 6).SubMatrix(other.Block(2, 1, 3, 6));
+  EXPECT_TRUE(mtx == MakeFilled(8, 8, 0.0));
+  EXPECT_THROW(mtx.Block(0, 0, 2, 2) += other.Block(0, 0, 2, 3),
+               std::logic_error);
+}
+
+TEST(MatrixView, AssignmentCopiesElements) {
+  auto mtx = MakeFilled(4, 4, 0.0);
+  auto src = MakeFilled(2, 2, 50.0);
+  mtx.Block(2, 2, 2, 2) = src;
+  EXPECT_TRUE(mtx.Block(2, 2, 2, 2) == src);
+  mtx.Row(0) = mtx.Row(3);
+  EXPECT_TRUE(mtx.Row(0) == mtx.Row(3));
+  mtx.Block(0, 0, 2, 2) = src + src * 2.0;
+  EXPECT_EQ(mtx(1, 1), 53.0 * 3);
+  EXPECT_THROW(mtx.Row(0) = mtx.Col(0), std::logic_error);
+}
+
+TEST(MatrixView, OperandsOfMatrixOperations) {
+  auto mtx = MakeFilled(9, 12, 1.0);
+  auto block = mtx.Block(1, 2, 5, 7);
+  auto copy = CopyBlock(mtx, 1, 2, 5, 7);
+  auto rhs = MakeFilled(7, 3, -2.0);
+
+  EXPECT_TRUE(block * rhs == copy * rhs);
+  EXPECT_TRUE(copy * mtx.Block(2, 3, 7, 4) ==
+              copy * CopyBlock(mtx, 2, 3, 7, 4));
+  EXPECT_TRUE(block.Transpose() == copy.Transpose());
+
+  S21Matrix<double> sum = copy;
+  sum += block;
+  EXPECT_TRUE(sum == copy * 2.0);
+  EXPECT_TRUE(copy == block);
+  EXPECT_TRUE(block == copy);
+
+  S21Matrix<double> from_view(block);
+  EXPECT_TRUE(from_view == copy);
+  S21Matrix<double> lazy = block + copy - block;
+  EXPECT_TRUE(lazy == copy);
+}
+
+TEST(MatrixView, SquareBlocks) {
+  S21Matrix<double> mtx(7, 7, 1.0);
+  for (size_t i = 0; i < 7; ++i) mtx(i, i) = 5.0 + i;
+  auto block = mtx.Block(1, 1, 5, 5);
+  auto copy = CopyBlock(mtx, 1, 1, 5, 5);
+  EXPECT_DOUBLE_EQ(block.Determinant(), copy.Determinant());
+  EXPECT_TRUE(block.InverseMatrix() == copy.InverseMatrix());
+  EXPECT_TRUE(block.CalcComplements() == copy.CalcComplements());
+}
+
+TEST(MatrixView, ExternalBuffers) {
+  std::vector<int> buffer{1, 2, 3, 0, 4, 5, 6, 0};
+  S21MatrixView<int> view(buffer.data(), 2, 3, 4);
+  S21Matrix<int> mtx(view);
+  EXPECT_EQ(mtx(1, 2), 6);
+  view *= 10;
+  EXPECT_EQ(buffer[6], 60);
+  EXPECT_EQ(buffer[3], 0);
+  std::stringstream ss;
+  ss << S21MatrixView<const int>(buffer.data(), 1, 2);
+  EXPECT_NE(ss.str().find("[[10, 20]]"), std::string::npos);
+}